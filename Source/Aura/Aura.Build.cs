@@ -18,6 +18,9 @@ public class Aura : ModuleRules
 			"GameplayTags", "GameplayTasks", "NavigationSystem", "Niagara", "AIModule"
 		});
 
+		// Dedicated servers never render, so the purely visual components and code paths are compiled out of them
+		PublicDefinitions.Add(Target.Type == TargetType.Server ? "WITH_AURA_COSMETICS=0" : "WITH_AURA_COSMETICS=1");
+
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 
 #define CUSTOM_DEPTH_RED 250
 #define CUSTOM_DEPTH_BLUE 251
@@ -10,4 +11,6 @@
 
 #define ECC_Projectile ECollisionChannel::ECC_GameTraceChannel1
 #define ECC_Target ECollisionChannel::ECC_GameTraceChannel2
-#define ECC_ExcludePlayers ECollisionChannel::ECC_GameTraceChannel3
\ No newline at end of file
+#define ECC_ExcludePlayers ECollisionChannel::ECC_GameTraceChannel3
+
+DECLARE_STATS_GROUP(TEXT("Aura"), STATGROUP_Aura, STATCAT_Advanced);
@@ -3,31 +3,34 @@
 
 #include "AI/BTService_FindNearestPlayer.h"
 #include "AIController.h"
+#include "EngineUtils.h"
 #include "BehaviorTree/BTFunctionLibrary.h"
-#include "Kismet/GameplayStatics.h"
+#include "Character/AuraCharacterBase.h"
 
 void UBTService_FindNearestPlayer::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
 	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 
 	const APawn* OwningPawn = AIOwner->GetPawn();
-	const FName TargetTag = OwningPawn->ActorHasTag(FName("Player")) ? FName("Enemy") : FName("Player");
+	if (!IsValid(OwningPawn)) return;
+
+	const AAuraCharacterBase* OwningCharacter = Cast<AAuraCharacterBase>(OwningPawn);
+	const EAuraTeam TargetTeam = OwningCharacter && OwningCharacter->GetTeam() == EAuraTeam::Player
+		                             ? EAuraTeam::Enemy
+		                             : EAuraTeam::Player;
 
-	TArray<AActor*> ActorsWithTag;
-	UGameplayStatics::GetAllActorsWithTag(OwningPawn, TargetTag, ActorsWithTag);
-	
 	float ClosestDistance = TNumericLimits<float>::Max();
 	AActor* ClosestActor = nullptr;
-	for (AActor* Actor : ActorsWithTag)
+	for (TActorIterator<AAuraCharacterBase> It(OwningPawn->GetWorld()); It; ++It)
 	{
-		if (IsValid(Actor) && IsValid(OwningPawn))
+		AAuraCharacterBase* Character = *It;
+		if (!IsValid(Character) || Character->GetTeam() != TargetTeam) continue;
+
+		const float Distance = OwningPawn->GetDistanceTo(Character);
+		if (Distance < ClosestDistance)
 		{
-			const float Distance = OwningPawn->GetDistanceTo(Actor);
-			if (Distance < ClosestDistance)
-			{
-				ClosestDistance = Distance;
-				ClosestActor = Actor;
-			}
+			ClosestDistance = Distance;
+			ClosestActor = Character;
 		}
 	}
 	UBTFunctionLibrary::SetBlackboardValueAsObject(this,TargetToFollowSelector, ClosestActor);
@@ -5,6 +5,7 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Game/AuraRandomSubsystem.h"
 
 void UAuraDamageGameplayAbility::CauseDamage(AActor* TargetActor)
 {
@@ -99,7 +100,9 @@ FTaggedMontage UAuraDamageGameplayAbility::GetRandomTaggedMontageFromArray(
 {
 	if (TaggedMontages.Num() > 0)
 	{
-		const int32 Selection = FMath::RandRange(0, TaggedMontages.Num() - 1);
+		const AActor* AvatarActor = GetAvatarActorFromActorInfo();
+		const int32 Selection = UAuraRandomSubsystem::GetStream(AvatarActor, AvatarActor).RandRange(
+			0, TaggedMontages.Num() - 1);
 		return TaggedMontages[Selection];
 	}
 
@@ -6,6 +6,7 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "Actor/AuraProjectile.h"
+#include "Game/AuraProjectileSubsystem.h"
 #include "Interaction/CombatInterface.h"
 
 void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -32,6 +33,16 @@ void UAuraProjectileSpell::SpawnProjectile(const FVector& ProjectileTargetLocati
 		Rotation.Pitch = PitchOverride;
 	}
 
+	if (ProjectileClass->GetDefaultObject<AAuraProjectile>()->bLightweight)
+	{
+		if (UAuraProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UAuraProjectileSubsystem>())
+		{
+			Projectiles->LaunchProjectile(ProjectileClass, SocketLocation, Rotation.Vector(),
+			                              GetAvatarActorFromActorInfo(), MakeDamageEffectParamsFromClassDefaults());
+			return;
+		}
+	}
+
 	FTransform SpawnTransform;
 	SpawnTransform.SetLocation(SocketLocation);
 	SpawnTransform.SetRotation(Rotation.Quaternion());
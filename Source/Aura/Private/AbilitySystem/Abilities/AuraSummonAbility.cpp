@@ -3,11 +3,14 @@
 
 #include "AbilitySystem/Abilities/AuraSummonAbility.h"
 
+#include "Game/AuraRandomSubsystem.h"
+
 
 TArray<FVector> UAuraSummonAbility::GetSpawnLocations()
 {
-	const FVector Forward = GetAvatarActorFromActorInfo()->GetActorForwardVector();
-	const FVector Location = GetAvatarActorFromActorInfo()->GetActorLocation();
+	const AActor* AvatarActor = GetAvatarActorFromActorInfo();
+	const FVector Forward = AvatarActor->GetActorForwardVector();
+	const FVector Location = AvatarActor->GetActorLocation();
 	const float DeltaSpread = SpawnSpread / NumMinions;
 
 
@@ -16,7 +19,9 @@ TArray<FVector> UAuraSummonAbility::GetSpawnLocations()
 	for (int32 i = 0; i < NumMinions; i++)
 	{
 		const FVector Direction = LeftOfSpread.RotateAngleAxis(DeltaSpread * i, FVector::UpVector);
-		FVector ChosenSpawnLocation = Location + Direction * FMath::FRandRange(MinSpawnDistance, MaxSpawnDistance);
+		const float Distance = UAuraRandomSubsystem::GetStream(AvatarActor, AvatarActor).FRandRange(
+			MinSpawnDistance, MaxSpawnDistance);
+		FVector ChosenSpawnLocation = Location + Direction * Distance;
 
 		FHitResult Hit;
 		GetWorld()->LineTraceSingleByChannel(Hit, ChosenSpawnLocation + FVector(0.f, 0.f, 400.f),
@@ -34,6 +39,8 @@ TArray<FVector> UAuraSummonAbility::GetSpawnLocations()
 
 TSubclassOf<APawn> UAuraSummonAbility::GetRandomMinionClass()
 {
-	const int32 Selection = FMath::RandRange(0, MinionClasses.Num() - 1);
+	const AActor* AvatarActor = GetAvatarActorFromActorInfo();
+	const int32 Selection = UAuraRandomSubsystem::GetStream(AvatarActor, AvatarActor).RandRange(
+		0, MinionClasses.Num() - 1);
 	return MinionClasses[Selection];
 }
@@ -75,6 +75,38 @@ void UAuraAbilitySystemComponent::AddCharacterPassiveAbilities(
 	}
 }
 
+void UAuraAbilitySystemComponent::GiveAbilities(TArrayView<FGameplayAbilitySpec> Specs)
+{
+	if (!IsOwnerActorAuthoritative()) return;
+
+	// While the list is locked GiveAbility defers the grants until it is unlocked again
+	if (AbilityScopeLockCount > 0)
+	{
+		for (const FGameplayAbilitySpec& Spec : Specs)
+		{
+			GiveAbility(Spec);
+		}
+		return;
+	}
+
+	ABILITYLIST_SCOPE_LOCK();
+	ActivatableAbilities.Items.Reserve(ActivatableAbilities.Items.Num() + Specs.Num());
+	for (FGameplayAbilitySpec& Spec : Specs)
+	{
+		if (!IsValid(Spec.Ability)) continue;
+
+		UGameplayAbility* Ability = Spec.Ability;
+		FGameplayAbilitySpec& OwnedSpec = ActivatableAbilities.Items.Add_GetRef(MoveTemp(Spec));
+		if (Ability->GetInstancingPolicy() == EGameplayAbilityInstancingPolicy::InstancedPerActor)
+		{
+			CreateNewInstanceOfAbility(OwnedSpec, Ability);
+		}
+		OnGiveAbility(OwnedSpec);
+	}
+	// New items get their replication IDs when the array is next serialized, one dirty mark covers them all
+	ActivatableAbilities.MarkArrayDirty();
+}
+
 void UAuraAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& InputTag)
 {
 	if (!InputTag.IsValid()) return;
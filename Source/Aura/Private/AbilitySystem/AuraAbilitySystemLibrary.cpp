@@ -6,6 +6,11 @@
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AuraAbilityTypes.h"
 #include "AuraGameplayTags.h"
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "Aura/Aura.h"
+#include "Aura/AuraLogChannels.h"
+#include "Character/AuraCharacterBase.h"
 #include "Game/AuraGameModeBase.h"
 #include "Game/LoadScreenSaveGame.h"
 #include "Interaction/CombatInterface.h"
@@ -14,6 +19,78 @@
 #include "UI/HUD/AuraHUD.h"
 #include "UI/WidgetController/AuraWidgetController.h"
 
+DECLARE_CYCLE_STAT(TEXT("Give Startup Abilities"), STAT_AuraGiveStartupAbilities, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Startup Abilities Granted"), STAT_AuraStartupAbilitiesGranted, STATGROUP_Aura);
+
+namespace AuraAbilitySystemLibrary
+{
+#if !UE_BUILD_SHIPPING
+	static TAutoConsoleVariable<bool> CVarVerifyAttributeSnapshots(
+		TEXT("Aura.Attributes.VerifySnapshots"),
+		false,
+		TEXT("Initializes every character through its default attribute effects and logs an error when the result\n")
+		TEXT("differs from the cached snapshot of its class and level."));
+#endif
+
+	/** Characters are checked first, they are what projectiles and abilities overlap nearly every time */
+	FORCEINLINE static FGenericTeamId GetTeamId(const AActor* Actor)
+	{
+		if (const AAuraCharacterBase* Character = Cast<AAuraCharacterBase>(Actor))
+		{
+			return Character->GetGenericTeamId();
+		}
+		const IGenericTeamAgentInterface* TeamAgent = Cast<IGenericTeamAgentInterface>(Actor);
+		return TeamAgent ? TeamAgent->GetGenericTeamId() : FGenericTeamId::NoTeam;
+	}
+
+	static void ApplyDefaultAttributeEffects(const UCharacterClassInfo* CharacterClassInfo,
+	                                         ECharacterClass CharacterClass, float Level, UAbilitySystemComponent* ASC)
+	{
+		AActor* AvatarActor = ASC->GetAvatarActor();
+		const FCharacterClassDefaultInfo& ClassDefaultInfo = CharacterClassInfo->CharacterClassInformation.FindChecked(
+			CharacterClass);
+
+		FGameplayEffectContextHandle PrimaryAttributesContextHandle = ASC->MakeEffectContext();
+		PrimaryAttributesContextHandle.AddSourceObject(AvatarActor);
+		const FGameplayEffectSpecHandle PrimaryAttributesSpecHandle = ASC->MakeOutgoingSpec(
+			ClassDefaultInfo.PrimaryAttributes, Level, PrimaryAttributesContextHandle);
+		ASC->ApplyGameplayEffectSpecToSelf(*PrimaryAttributesSpecHandle.Data.Get());
+
+		FGameplayEffectContextHandle SecondaryAttributesContextHandle = ASC->MakeEffectContext();
+		SecondaryAttributesContextHandle.AddSourceObject(AvatarActor);
+		const FGameplayEffectSpecHandle SecondaryAttributesSpecHandle = ASC->MakeOutgoingSpec(
+			CharacterClassInfo->SecondaryAttributes, Level, SecondaryAttributesContextHandle);
+		ASC->ApplyGameplayEffectSpecToSelf(*SecondaryAttributesSpecHandle.Data.Get());
+
+		FGameplayEffectContextHandle VitalAttributesContextHandle = ASC->MakeEffectContext();
+		VitalAttributesContextHandle.AddSourceObject(AvatarActor);
+		const FGameplayEffectSpecHandle VitalAttributesSpecHandle = ASC->MakeOutgoingSpec(
+			CharacterClassInfo->VitalAttributes, Level, VitalAttributesContextHandle);
+		ASC->ApplyGameplayEffectSpecToSelf(*VitalAttributesSpecHandle.Data.Get());
+	}
+
+	static FAuraAttributeSnapshot TakeAttributeSnapshot(UAbilitySystemComponent* ASC, bool bCacheable)
+	{
+		FAuraAttributeSnapshot Snapshot;
+		Snapshot.bCacheable = bCacheable;
+
+		TArray<FGameplayAttribute> Attributes;
+		ASC->GetAllAttributes(Attributes);
+		// Health and Mana are clamped to their max when set, so they have to come after MaxHealth and MaxMana
+		Attributes.StableSort([](const FGameplayAttribute& A, const FGameplayAttribute& B)
+		{
+			const bool bAVital = A == UAuraAttributeSet::GetHealthAttribute() || A == UAuraAttributeSet::GetManaAttribute();
+			const bool bBVital = B == UAuraAttributeSet::GetHealthAttribute() || B == UAuraAttributeSet::GetManaAttribute();
+			return !bAVital && bBVital;
+		});
+		for (const FGameplayAttribute& Attribute : Attributes)
+		{
+			Snapshot.BaseValues.Emplace(Attribute, ASC->GetNumericAttributeBase(Attribute));
+		}
+		return Snapshot;
+	}
+}
+
 bool UAuraAbilitySystemLibrary::MakeWidgetControllerParams(const UObject* WorldContextObject,
                                                            FWidgetControllerParams& OutWCParams, AAuraHUD*& OutAuraHUD)
 {
@@ -74,28 +151,55 @@ void UAuraAbilitySystemLibrary::InitializeDefaultAttributes(const UObject* World
                                                             ECharacterClass CharacterClass, float Level,
                                                             UAbilitySystemComponent* ASC)
 {
-	AActor* AvatarActor = ASC->GetAvatarActor();
+	using namespace AuraAbilitySystemLibrary;
 
-	UCharacterClassInfo* CharacterClassInfo = GetCharacterClassInfo(WorldContextObject);
-	FCharacterClassDefaultInfo ClassDefaultInfo = CharacterClassInfo->GetClassDefaultInfo(CharacterClass);
+	AAuraGameModeBase* AuraGameMode = Cast<AAuraGameModeBase>(UGameplayStatics::GetGameMode(WorldContextObject));
+	if (AuraGameMode == nullptr) return;
+	const UCharacterClassInfo* CharacterClassInfo = AuraGameMode->CharacterClassInfo;
+	if (CharacterClassInfo == nullptr) return;
 
-	FGameplayEffectContextHandle PrimaryAttributesContextHandle = ASC->MakeEffectContext();
-	PrimaryAttributesContextHandle.AddSourceObject(AvatarActor);
-	const FGameplayEffectSpecHandle PrimaryAttributesSpecHandle = ASC->MakeOutgoingSpec(
-		ClassDefaultInfo.PrimaryAttributes, Level, PrimaryAttributesContextHandle);
-	ASC->ApplyGameplayEffectSpecToSelf(*PrimaryAttributesSpecHandle.Data.Get());
+	const TPair<ECharacterClass, int32> SnapshotKey(CharacterClass, FMath::RoundToInt32(Level));
+	const FAuraAttributeSnapshot* Snapshot = AuraGameMode->AttributeSnapshots.Find(SnapshotKey);
+#if !UE_BUILD_SHIPPING
+	const bool bVerify = CVarVerifyAttributeSnapshots.GetValueOnGameThread();
+#else
+	const bool bVerify = false;
+#endif
 
-	FGameplayEffectContextHandle SecondaryAttributesContextHandle = ASC->MakeEffectContext();
-	SecondaryAttributesContextHandle.AddSourceObject(AvatarActor);
-	const FGameplayEffectSpecHandle SecondaryAttributesSpecHandle = ASC->MakeOutgoingSpec(
-		CharacterClassInfo->SecondaryAttributes, Level, SecondaryAttributesContextHandle);
-	ASC->ApplyGameplayEffectSpecToSelf(*SecondaryAttributesSpecHandle.Data.Get());
+	if (Snapshot && Snapshot->bCacheable && !bVerify)
+	{
+		for (const TPair<FGameplayAttribute, float>& BaseValue : Snapshot->BaseValues)
+		{
+			ASC->SetNumericAttributeBase(BaseValue.Key, BaseValue.Value);
+		}
+		return;
+	}
 
-	FGameplayEffectContextHandle VitalAttributesContextHandle = ASC->MakeEffectContext();
-	VitalAttributesContextHandle.AddSourceObject(AvatarActor);
-	const FGameplayEffectSpecHandle VitalAttributesSpecHandle = ASC->MakeOutgoingSpec(
-		CharacterClassInfo->VitalAttributes, Level, VitalAttributesContextHandle);
-	ASC->ApplyGameplayEffectSpecToSelf(*VitalAttributesSpecHandle.Data.Get());
+	// Only a snapshot of a character whose default effects were all instant can stand in for the effects
+	const int32 NumActiveEffects = ASC->GetActiveEffects(FGameplayEffectQuery()).Num();
+	ApplyDefaultAttributeEffects(CharacterClassInfo, CharacterClass, Level, ASC);
+	if (Snapshot == nullptr)
+	{
+		const bool bCacheable = ASC->GetActiveEffects(FGameplayEffectQuery()).Num() == NumActiveEffects;
+		AuraGameMode->AttributeSnapshots.Add(SnapshotKey, TakeAttributeSnapshot(ASC, bCacheable));
+		return;
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (bVerify && Snapshot->bCacheable)
+	{
+		for (const TPair<FGameplayAttribute, float>& BaseValue : Snapshot->BaseValues)
+		{
+			const float EffectValue = ASC->GetNumericAttributeBase(BaseValue.Key);
+			if (!FMath::IsNearlyEqual(EffectValue, BaseValue.Value))
+			{
+				UE_LOG(LogAura, Error, TEXT("Attribute snapshot of class %d level %d has %s = %f, the effects give %f"),
+				       static_cast<int32>(CharacterClass), SnapshotKey.Value, *BaseValue.Key.GetName(), BaseValue.Value,
+				       EffectValue);
+			}
+		}
+	}
+#endif
 }
 
 void UAuraAbilitySystemLibrary::InitializeDefaultAttributesFromSaveData(const UObject* WorldContextObject,
@@ -142,22 +246,39 @@ void UAuraAbilitySystemLibrary::InitializeDefaultAttributesFromSaveData(const UO
 void UAuraAbilitySystemLibrary::GiveStartupAbilities(const UObject* WorldContextObject, UAbilitySystemComponent* ASC,
                                                      ECharacterClass CharacterClass)
 {
-	UCharacterClassInfo* CharacterClassInfo = GetCharacterClassInfo(WorldContextObject);
-	if (CharacterClassInfo == nullptr) return;
+	SCOPE_CYCLE_COUNTER(STAT_AuraGiveStartupAbilities);
+
+	AAuraGameModeBase* AuraGameMode = Cast<AAuraGameModeBase>(UGameplayStatics::GetGameMode(WorldContextObject));
+	if (AuraGameMode == nullptr || AuraGameMode->CharacterClassInfo == nullptr) return;
+
+	const UCharacterClassInfo* CharacterClassInfo = AuraGameMode->CharacterClassInfo;
+	TArray<FGameplayAbilitySpec, TInlineAllocator<8>> Specs;
 	for (TSubclassOf<UGameplayAbility> AbilityClass : CharacterClassInfo->CommonAbilities)
 	{
-		FGameplayAbilitySpec AbilitySpec = FGameplayAbilitySpec(AbilityClass, 1);
-		ASC->GiveAbility(AbilitySpec);
+		Specs.Emplace(AbilityClass, 1);
+	}
+	AActor* AvatarActor = ASC->GetAvatarActor();
+	if (AvatarActor->Implements<UCombatInterface>())
+	{
+		const int32 Level = ICombatInterface::Execute_GetPlayerLevel(AvatarActor);
+		const FCharacterClassDefaultInfo& DefaultInfo = CharacterClassInfo->CharacterClassInformation.FindChecked(
+			CharacterClass);
+		for (TSubclassOf<UGameplayAbility> AbilityClass : DefaultInfo.StartupAbilities)
+		{
+			Specs.Emplace(AbilityClass, Level);
+		}
 	}
-	const FCharacterClassDefaultInfo& DefaultInfo = CharacterClassInfo->GetClassDefaultInfo(CharacterClass);
-	for (TSubclassOf<UGameplayAbility> AbilityClass : DefaultInfo.StartupAbilities)
+	INC_DWORD_STAT_BY(STAT_AuraStartupAbilitiesGranted, Specs.Num());
+
+	if (UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(ASC))
+	{
+		AuraASC->GiveAbilities(Specs);
+	}
+	else
 	{
-		if (ASC->GetAvatarActor()->Implements<UCombatInterface>())
+		for (const FGameplayAbilitySpec& Spec : Specs)
 		{
-			FGameplayAbilitySpec AbilitySpec = FGameplayAbilitySpec(AbilityClass,
-			                                                        ICombatInterface::Execute_GetPlayerLevel(
-				                                                        ASC->GetAvatarActor()));
-			ASC->GiveAbility(AbilitySpec);
+			ASC->GiveAbility(Spec);
 		}
 	}
 }
@@ -559,10 +680,8 @@ void UAuraAbilitySystemLibrary::GetClosestTargets(int32 MaxTargets, const TArray
 
 bool UAuraAbilitySystemLibrary::IsNotFriend(AActor* FirstActor, AActor* SecondActor)
 {
-	const bool bBothArePlayers = FirstActor->ActorHasTag(FName("Player")) && SecondActor->ActorHasTag(FName("Player"));
-	const bool bBothAreEnemies = FirstActor->ActorHasTag(FName("Enemy")) && SecondActor->ActorHasTag(FName("Enemy"));
-	const bool bFriends = bBothArePlayers || bBothAreEnemies;
-	return !bFriends;
+	const FGenericTeamId FirstTeam = AuraAbilitySystemLibrary::GetTeamId(FirstActor);
+	return FirstTeam == FGenericTeamId::NoTeam || FirstTeam != AuraAbilitySystemLibrary::GetTeamId(SecondActor);
 }
 
 FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams)
@@ -3,23 +3,132 @@
 
 #include "AbilitySystem/Data/LootTiers.h"
 
+#include "Aura/Aura.h"
+
+DECLARE_CYCLE_STAT(TEXT("Roll Loot"), STAT_AuraRollLoot, STATGROUP_Aura);
+
+namespace LootTiers
+{
+	/** Chance of each copy under the original per copy roll of FRandRange(1, 100) < ChanceToSpawn */
+	static double GetCopyChance(const FLootItem& Item)
+	{
+		return FMath::Clamp((Item.ChanceToSpawn - 1.0) / 99.0, 0.0, 1.0);
+	}
+}
+
+void FLootCountTable::Build(int32 MaxCount, double CopyChance)
+{
+	MaxCount = FMath::Max(MaxCount, 0);
+	const int32 NumOutcomes = MaxCount + 1;
+	Probability.SetNumUninitialized(NumOutcomes);
+	Alias.SetNumUninitialized(NumOutcomes);
+
+	// Binomial distribution of the copy count, scaled so the average column holds 1
+	TArray<double, TInlineAllocator<16>> Scaled;
+	Scaled.SetNumZeroed(NumOutcomes);
+	if (CopyChance <= 0.0)
+	{
+		Scaled[0] = NumOutcomes;
+	}
+	else if (CopyChance >= 1.0)
+	{
+		Scaled[MaxCount] = NumOutcomes;
+	}
+	else
+	{
+		double Chance = FMath::Pow(1.0 - CopyChance, MaxCount);
+		const double Odds = CopyChance / (1.0 - CopyChance);
+		for (int32 Count = 0; Count < NumOutcomes; ++Count)
+		{
+			Scaled[Count] = Chance * NumOutcomes;
+			Chance *= Odds * (MaxCount - Count) / (Count + 1);
+		}
+	}
+
+	// Vose's alias method
+	TArray<int32, TInlineAllocator<16>> Small;
+	TArray<int32, TInlineAllocator<16>> Large;
+	for (int32 Count = 0; Count < NumOutcomes; ++Count)
+	{
+		(Scaled[Count] < 1.0 ? Small : Large).Add(Count);
+	}
+	while (!Small.IsEmpty() && !Large.IsEmpty())
+	{
+		const int32 Less = Small.Pop(EAllowShrinking::No);
+		const int32 More = Large.Pop(EAllowShrinking::No);
+		Probability[Less] = Scaled[Less];
+		Alias[Less] = More;
+		Scaled[More] = Scaled[More] + Scaled[Less] - 1.0;
+		(Scaled[More] < 1.0 ? Small : Large).Add(More);
+	}
+	// Whatever is left is 1 up to rounding error
+	for (const int32 Count : Large)
+	{
+		Probability[Count] = 1.f;
+		Alias[Count] = Count;
+	}
+	for (const int32 Count : Small)
+	{
+		Probability[Count] = 1.f;
+		Alias[Count] = Count;
+	}
+}
+
+int32 FLootCountTable::Sample(FRandomStream& Stream) const
+{
+	const int32 Column = Stream.RandHelper(Probability.Num());
+	return Stream.GetFraction() < Probability[Column] ? Column : Alias[Column];
+}
+
 TArray<FLootItem> ULootTiers::GetLootItems()
 {
 	TArray<FLootItem> ReturnItems;
+	FRandomStream Stream(FMath::Rand());
+	RollLoot(Stream, ReturnItems);
+	return ReturnItems;
+}
+
+void ULootTiers::RollLoot(FRandomStream& Stream, TArray<FLootItem>& OutItems)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraRollLoot);
+	OutItems.Reset();
+
+	if (CountTables.Num() != LootItems.Num())
+	{
+		BuildCountTables();
+	}
 
-	for (FLootItem& Item : LootItems)
+	for (int32 Index = 0; Index < LootItems.Num(); ++Index)
 	{
-		for (int32 i = 0; i < Item.MaxNumberToSpawn; ++i)
+		const int32 Count = CountTables[Index].Sample(Stream);
+		for (int32 i = 0; i < Count; ++i)
 		{
-			if (FMath::FRandRange(1.f, 100.f) < Item.ChanceToSpawn)
-			{
-				FLootItem NewItem;
-				NewItem.LootClass = Item.LootClass;
-				NewItem.bLootLevelOverride = Item.bLootLevelOverride;
-				ReturnItems.Add(NewItem);
-			}
+			FLootItem& NewItem = OutItems.AddDefaulted_GetRef();
+			NewItem.LootClass = LootItems[Index].LootClass;
+			NewItem.bLootLevelOverride = LootItems[Index].bLootLevelOverride;
 		}
 	}
+}
 
-	return ReturnItems;
+void ULootTiers::PostLoad()
+{
+	Super::PostLoad();
+	BuildCountTables();
+}
+
+#if WITH_EDITOR
+void ULootTiers::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	BuildCountTables();
+}
+#endif
+
+void ULootTiers::BuildCountTables()
+{
+	CountTables.SetNum(LootItems.Num());
+	for (int32 Index = 0; Index < LootItems.Num(); ++Index)
+	{
+		CountTables[Index].Build(LootItems[Index].MaxNumberToSpawn, LootTiers::GetCopyChance(LootItems[Index]));
+	}
 }
@@ -1,47 +1,9 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
+// Fill out your copyright notice in the Description page of Project Settings.
 
 
 #include "AbilitySystem/Debuff/DebuffNiagaraComponent.h"
 
-#include "AbilitySystemBlueprintLibrary.h"
-#include "AbilitySystemComponent.h"
-#include "Interaction/CombatInterface.h"
-
-
 UDebuffNiagaraComponent::UDebuffNiagaraComponent()
 {
 	bAutoActivate = false;
 }
-
-void UDebuffNiagaraComponent::BeginPlay()
-{
-	Super::BeginPlay();
-
-	ICombatInterface* CombatInterface = Cast<ICombatInterface>(GetOwner());
-	if (UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner()))
-	{
-		ASC->RegisterGameplayTagEvent(DebuffTag, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UDebuffNiagaraComponent::DebuffTagChanged);
-	}
-	else if (CombatInterface)
-	{
-		CombatInterface->GetOnASCRegisteredDelegate().AddWeakLambda(this, [this](UAbilitySystemComponent* InASC)
-		{
-			InASC->RegisterGameplayTagEvent(DebuffTag, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UDebuffNiagaraComponent::DebuffTagChanged);
-		});
-	}
-}
-
-void UDebuffNiagaraComponent::DebuffTagChanged(const FGameplayTag CallbackTag, int32 NewCount)
-{
-	const bool bOwnerValid = IsValid(GetOwner());
-	const bool bOwnerAlive = GetOwner()->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(GetOwner());
-
-	if (NewCount > 0 && bOwnerValid && bOwnerAlive)
-	{
-		Activate();
-	}
-	else
-	{
-		Deactivate();
-	}
-}
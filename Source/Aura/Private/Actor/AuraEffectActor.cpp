@@ -5,11 +5,26 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Actor/AuraScalarFade.h"
+#include "Aura/AuraLogChannels.h"
+#include "Character/AuraCharacterBase.h"
+#include "Game/AuraEffectsSubsystem.h"
+#include "Game/AuraPickupPoolSubsystem.h"
 #include "Kismet/KismetMathLibrary.h"
 
+namespace AuraEffectActor
+{
+#if !UE_BUILD_SHIPPING
+	/** Pickup classes already reported as moving on the CPU */
+	static TSet<FName> CPUMovementClasses;
+#endif
+}
+
 AAuraEffectActor::AAuraEffectActor()
 {
-	PrimaryActorTick.bCanEverTick = false;
+	// Only ticks for the CPU movement fallback near a local player
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	SetRootComponent(CreateDefaultSubobject<USceneComponent>("SceneRoot"));
 }
@@ -18,12 +33,20 @@ void AAuraEffectActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 	RunningTime += DeltaTime;
-	const float SinePeriod = 2 * PI / SinePeriodConstant;
 	if (RunningTime > SinePeriod)
 	{
 		RunningTime = 0.f;
 	}
 	ItemMovement(DeltaTime);
+
+	if (bSinusoidalMovement)
+	{
+		SetActorLocation(CalculatedLocation);
+	}
+	if (bRotates)
+	{
+		SetActorRotation(CalculatedRotation);
+	}
 }
 
 void AAuraEffectActor::BeginPlay()
@@ -33,6 +56,46 @@ void AAuraEffectActor::BeginPlay()
 	InitialLocation = GetActorLocation();
 	CalculatedLocation = InitialLocation;
 	CalculatedRotation = GetActorRotation();
+	UpdateMovement();
+}
+
+void AAuraEffectActor::ActivateFromPool(const FTransform& Transform)
+{
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	RunningTime = 0.f;
+	InitialLocation = GetActorLocation();
+	CalculatedLocation = InitialLocation;
+	CalculatedRotation = GetActorRotation();
+	UpdateMovement();
+	OnActivatedFromPool();
+}
+
+void AAuraEffectActor::DeactivateForPool()
+{
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	GetWorldTimerManager().ClearTimer(MovementTickTimer);
+	ActiveEffectHandles.Empty();
+
+	// DropLoot only sets the level of loot that overrides it, the rest drop at the class level
+	ActorLevel = GetClass()->GetDefaultObject<AAuraEffectActor>()->ActorLevel;
+}
+
+void AAuraEffectActor::DestroyOrReturnToPool()
+{
+	UAuraPickupPoolSubsystem* PickupPool = GetWorld()->GetSubsystem<UAuraPickupPoolSubsystem>();
+	if (bReturnToPool && PickupPool)
+	{
+		PickupPool->ReleasePickup(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
 
 void AAuraEffectActor::StartSinusoidalMovement()
@@ -40,17 +103,78 @@ void AAuraEffectActor::StartSinusoidalMovement()
 	bSinusoidalMovement = true;
 	InitialLocation = GetActorLocation();
 	CalculatedLocation = InitialLocation;
+	UpdateMovement();
 }
 
 void AAuraEffectActor::StartRotation()
 {
 	bRotates = true;
 	CalculatedRotation = GetActorRotation();
+	UpdateMovement();
+}
+
+void AAuraEffectActor::UpdateMovement()
+{
+	SetActorTickEnabled(false);
+	GetWorldTimerManager().ClearTimer(MovementTickTimer);
+#if WITH_AURA_COSMETICS
+	if (!bRotates && !bSinusoidalMovement) return;
+	if (PushMovementToMaterials()) return;
+
+#if !UE_BUILD_SHIPPING
+	bool bAlreadyReported = false;
+	AuraEffectActor::CPUMovementClasses.Add(GetClass()->GetFName(), &bAlreadyReported);
+	if (!bAlreadyReported)
+	{
+		UE_LOG(LogAura, Log, TEXT("%s has no mesh with the pickup movement material, it moves on the CPU near local players"),
+		       *GetClass()->GetName());
+	}
+#endif
+
+	RunningTime = 0.f;
+	SinePeriod = 2 * PI / SinePeriodConstant;
+	GetWorldTimerManager().SetTimer(MovementTickTimer, this, &AAuraEffectActor::UpdateMovementTick, 0.5f, true, 0.f);
+#endif
+}
+
+bool AAuraEffectActor::PushMovementToMaterials()
+{
+	const float StartTime = GetWorld()->GetTimeSeconds();
+	bool bPushed = false;
+
+	TInlineComponentArray<UPrimitiveComponent*> Primitives(this);
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		const UMaterialInterface* Material = Primitive->GetMaterial(0);
+		if (Material == nullptr) continue;
+
+		const int32 AmplitudeIndex = FAuraScalarFade::FindCustomDataIndex(Material, BobAmplitudeParameterName);
+		const int32 FrequencyIndex = FAuraScalarFade::FindCustomDataIndex(Material, BobFrequencyParameterName);
+		const int32 SpinRateIndex = FAuraScalarFade::FindCustomDataIndex(Material, SpinRateParameterName);
+		const int32 StartTimeIndex = FAuraScalarFade::FindCustomDataIndex(Material, MovementStartTimeParameterName);
+		if (AmplitudeIndex == INDEX_NONE || FrequencyIndex == INDEX_NONE || SpinRateIndex == INDEX_NONE ||
+			StartTimeIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		Primitive->SetCustomPrimitiveDataFloat(AmplitudeIndex, bSinusoidalMovement ? SineAmplitude : 0.f);
+		Primitive->SetCustomPrimitiveDataFloat(FrequencyIndex, SinePeriodConstant);
+		Primitive->SetCustomPrimitiveDataFloat(SpinRateIndex, bRotates ? RotationRate : 0.f);
+		Primitive->SetCustomPrimitiveDataFloat(StartTimeIndex, StartTime);
+		bPushed = true;
+	}
+	return bPushed;
+}
+
+void AAuraEffectActor::UpdateMovementTick()
+{
+	SetActorTickEnabled(UAuraEffectsSubsystem::IsNearLocalPlayer(GetWorld(), GetActorLocation(), MovementTickDistance));
 }
 
 void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGameplayEffect> GameplayEffectClass)
 {
-	if (TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies) return;
+	if (IsIgnoredTarget(TargetActor)) return;
 
 	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 	if (TargetASC == nullptr) return;
@@ -67,18 +191,18 @@ void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGam
 		EGameplayEffectDurationType::Infinite;
 	if (bIsInfinite && InfiniteEffectRemovalPolicy == EEffectRemovalPolicy::RemoveOnEndOverlap)
 	{
-		ActiveEffectHandles.Add(ActiveEffectHandle, TargetASC);
+		ActiveEffectHandles.FindOrAdd(TargetASC).Add(ActiveEffectHandle);
 	}
 
 	if (!bIsInfinite)
 	{
-		Destroy();
+		DestroyOrReturnToPool();
 	}
 }
 
 void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 {
-	if (TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies) return;
+	if (IsIgnoredTarget(TargetActor)) return;
 
 	if (InstantEffectApplicationPolicy == EEffectApplicationPolicy::ApplyOnOverlap)
 	{
@@ -96,7 +220,7 @@ void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 
 void AAuraEffectActor::OnEndOverlap(AActor* TargetActor)
 {
-	if (TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectsToEnemies) return;
+	if (IsIgnoredTarget(TargetActor)) return;
 
 	if (InstantEffectApplicationPolicy == EEffectApplicationPolicy::ApplyOnEndOverlap)
 	{
@@ -115,22 +239,25 @@ void AAuraEffectActor::OnEndOverlap(AActor* TargetActor)
 		UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor);
 		if (!IsValid(TargetASC)) return;
 
-		TArray<FActiveGameplayEffectHandle> HandlesToRemove;
-		for (TTuple<FActiveGameplayEffectHandle, UAbilitySystemComponent*> HandlePair : ActiveEffectHandles)
+		TArray<FActiveGameplayEffectHandle, TInlineAllocator<2>> HandlesToRemove;
+		if (ActiveEffectHandles.RemoveAndCopyValue(TargetASC, HandlesToRemove))
 		{
-			if (TargetASC == HandlePair.Value)
+			for (const FActiveGameplayEffectHandle& Handle : HandlesToRemove)
 			{
-				TargetASC->RemoveActiveGameplayEffect(HandlePair.Key, 1);
-				HandlesToRemove.Add(HandlePair.Key);
+				TargetASC->RemoveActiveGameplayEffect(Handle, 1);
 			}
 		}
-		for (FActiveGameplayEffectHandle& Handle : HandlesToRemove)
-		{
-			ActiveEffectHandles.FindAndRemoveChecked(Handle);
-		}
 	}
 }
 
+bool AAuraEffectActor::IsIgnoredTarget(const AActor* TargetActor) const
+{
+	if (bApplyEffectsToEnemies) return false;
+
+	const AAuraCharacterBase* Character = Cast<AAuraCharacterBase>(TargetActor);
+	return Character && Character->GetTeam() == EAuraTeam::Enemy;
+}
+
 void AAuraEffectActor::ItemMovement(float DeltaTime)
 {
 	if (bRotates)
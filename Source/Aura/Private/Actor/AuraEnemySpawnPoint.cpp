@@ -3,16 +3,24 @@
 
 #include "Actor/AuraEnemySpawnPoint.h"
 
+#include "Aura/Aura.h"
+#include "Aura/AuraLogChannels.h"
 #include "Character/AuraEnemy.h"
+#include "Game/AuraEnemyPoolSubsystem.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Classes Loaded Synchronously"), STAT_AuraEnemyClassSyncLoads, STATGROUP_Aura);
 
 void AAuraEnemySpawnPoint::SpawnEnemy()
 {
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	AAuraEnemy* Enemy = GetWorld()->SpawnActorDeferred<AAuraEnemy>(EnemyClass, GetActorTransform());
-	Enemy->SetLevel(EnemyLevel);
-	Enemy->SetCharacterClass(CharacterClass);
-	Enemy->FinishSpawning(GetActorTransform());
-	Enemy->SpawnDefaultController();
+	if (UAuraEnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAuraEnemyPoolSubsystem>())
+	{
+		if (EnemyClass.IsPending())
+		{
+			// The spawn volume's preload didn't cover this point or hadn't finished, this load hitches the game thread
+			INC_DWORD_STAT(STAT_AuraEnemyClassSyncLoads);
+			UE_LOG(LogAura, Warning, TEXT("[%s] loads enemy class [%s] synchronously"), *GetName(),
+			       *EnemyClass.ToString());
+		}
+		EnemyPool->AcquireEnemy(EnemyClass.LoadSynchronous(), GetActorTransform(), EnemyLevel, CharacterClass);
+	}
 }
@@ -5,6 +5,9 @@
 
 #include "Actor/AuraEnemySpawnPoint.h"
 #include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/AssetManager.h"
+#include "Game/AuraSpawnQueueSubsystem.h"
 #include "Interaction/PlayerInterface.h"
 
 
@@ -18,6 +21,13 @@ AAuraEnemySpawnVolume::AAuraEnemySpawnVolume()
 	Box->SetCollisionObjectType(ECC_WorldStatic);
 	Box->SetCollisionResponseToAllChannels(ECR_Ignore);
 	Box->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+
+	PreloadSphere = CreateDefaultSubobject<USphereComponent>("PreloadSphere");
+	PreloadSphere->SetupAttachment(Box);
+	PreloadSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	PreloadSphere->SetCollisionObjectType(ECC_WorldStatic);
+	PreloadSphere->SetCollisionResponseToAllChannels(ECR_Ignore);
+	PreloadSphere->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 }
 
 void AAuraEnemySpawnVolume::LoadActor_Implementation()
@@ -32,6 +42,31 @@ void AAuraEnemySpawnVolume::BeginPlay()
 {
 	Super::BeginPlay();
 	Box->OnComponentBeginOverlap.AddDynamic(this, &AAuraEnemySpawnVolume::OnBoxOverlap);
+
+	PreloadSphere->SetSphereRadius(Box->Bounds.SphereRadius + PreloadDistance);
+	PreloadSphere->OnComponentBeginOverlap.AddDynamic(this, &AAuraEnemySpawnVolume::OnPreloadOverlap);
+}
+
+void AAuraEnemySpawnVolume::OnPreloadOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	// Enemies only spawn on the server, clients get their classes through replication
+	if (!HasAuthority() || !OtherActor->Implements<UPlayerInterface>()) return;
+
+	PreloadSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	TArray<FSoftObjectPath> EnemyClasses;
+	for (const AAuraEnemySpawnPoint* Point : SpawnPoints)
+	{
+		if (IsValid(Point) && Point->EnemyClass.IsPending())
+		{
+			EnemyClasses.AddUnique(Point->EnemyClass.ToSoftObjectPath());
+		}
+	}
+	if (!EnemyClasses.IsEmpty())
+	{
+		PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(EnemyClasses);
+	}
 }
 
 void AAuraEnemySpawnVolume::OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
@@ -40,12 +75,10 @@ void AAuraEnemySpawnVolume::OnBoxOverlap(UPrimitiveComponent* OverlappedComponen
 	if (!OtherActor->Implements<UPlayerInterface>()) return;
 
 	bReached = true;
-	for (AAuraEnemySpawnPoint* Point : SpawnPoints)
+	if (UAuraSpawnQueueSubsystem* SpawnQueue = GetWorld()->GetSubsystem<UAuraSpawnQueueSubsystem>())
 	{
-		if (IsValid(Point))
-		{
-			Point->SpawnEnemy();
-		}
+		SpawnQueue->QueueWave(SpawnPoints, OtherActor->GetActorLocation());
 	}
 	Box->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	PreloadSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
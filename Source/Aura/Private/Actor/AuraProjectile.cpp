@@ -5,11 +5,12 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "Aura/Aura.h"
 #include "Components/AudioComponent.h"
 #include "Components/SphereComponent.h"
+#include "Game/AuraEffectsSubsystem.h"
+#include "Game/AuraRandomSubsystem.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -45,8 +46,8 @@ void AAuraProjectile::BeginPlay()
 
 void AAuraProjectile::OnHit()
 {
-	UGameplayStatics::PlaySoundAtLocation(this, ImpactSound, GetActorLocation(), FRotator::ZeroRotator);
-	UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ImpactEffect, GetActorLocation());
+	UAuraEffectsSubsystem::PlaySoundAtLocation(this, ImpactSound, GetActorLocation());
+	UAuraEffectsSubsystem::SpawnSystemAtLocation(this, ImpactEffect, GetActorLocation());
 	if (LoopingSoundComponent)
 	{
 		LoopingSoundComponent->Stop();
@@ -72,21 +73,10 @@ void AAuraProjectile::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent,
 	{
 		if (UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OtherActor))
 		{
-			const FVector DeathImpulse = GetActorForwardVector() * DamageEffectParams.DeathImpulseMagnitude;
-			DamageEffectParams.DeathImpulse = DeathImpulse;
-			const bool bKnockback = FMath::RandRange(1, 100) < DamageEffectParams.KnockbackChance;
-			if (bKnockback)
-			{
-				FRotator Rotation = GetActorRotation();
-				Rotation.Pitch = 45.f;
-
-				const FVector KnockbackDirection = Rotation.Vector();
-				const FVector KnockbackForce = KnockbackDirection * DamageEffectParams.KnockbackForceMagnitude;
-				DamageEffectParams.KnockbackForce = KnockbackForce;
-			}
-
-			DamageEffectParams.TargetAbilitySystemComponent = TargetASC;
-			UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams);
+			const AActor* SourceAvatar = DamageEffectParams.SourceAbilitySystemComponent->GetAvatarActor();
+			const bool bKnockback = UAuraRandomSubsystem::GetStream(this, SourceAvatar).RandRange(1, 100) <
+				DamageEffectParams.KnockbackChance;
+			ApplyProjectileDamage(DamageEffectParams, TargetASC, GetActorRotation(), bKnockback);
 		}
 
 		Destroy();
@@ -94,6 +84,31 @@ void AAuraProjectile::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent,
 	else bHit = true;
 }
 
+float AAuraProjectile::GetCollisionRadius() const
+{
+	return Sphere->GetScaledSphereRadius();
+}
+
+void AAuraProjectile::ApplyProjectileDamage(FDamageEffectParams& DamageEffectParams,
+                                            UAbilitySystemComponent* TargetASC, const FRotator& Rotation,
+                                            bool bKnockback)
+{
+	const FVector DeathImpulse = Rotation.Vector() * DamageEffectParams.DeathImpulseMagnitude;
+	DamageEffectParams.DeathImpulse = DeathImpulse;
+	if (bKnockback)
+	{
+		FRotator KnockbackRotation = Rotation;
+		KnockbackRotation.Pitch = 45.f;
+
+		const FVector KnockbackDirection = KnockbackRotation.Vector();
+		const FVector KnockbackForce = KnockbackDirection * DamageEffectParams.KnockbackForceMagnitude;
+		DamageEffectParams.KnockbackForce = KnockbackForce;
+	}
+
+	DamageEffectParams.TargetAbilitySystemComponent = TargetASC;
+	UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams);
+}
+
 bool AAuraProjectile::IsValidOverlap(AActor* OtherActor)
 {
 	if (DamageEffectParams.SourceAbilitySystemComponent == nullptr) return false;
@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Actor/AuraProjectileBatch.h"
+
+AAuraProjectileBatch::AAuraProjectileBatch()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetHidden(true);
+}
+
+void AAuraProjectileBatch::MulticastLaunch_Implementation(const FAuraProjectileLaunch& Launch)
+{
+	if (HasAuthority()) return;
+
+	if (UAuraProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UAuraProjectileSubsystem>())
+	{
+		Projectiles->AddProjectile(Launch, FDamageEffectParams());
+	}
+}
+
+void AAuraProjectileBatch::MulticastHit_Implementation(uint32 Id, FVector_NetQuantize Location)
+{
+	if (HasAuthority()) return;
+
+	if (UAuraProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UAuraProjectileSubsystem>())
+	{
+		Projectiles->EndProjectile(Id, Location);
+	}
+}
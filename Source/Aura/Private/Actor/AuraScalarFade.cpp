@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Actor/AuraScalarFade.h"
+
+#include "Aura/Aura.h"
+#include "Components/PrimitiveComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Custom Data Fades"), STAT_AuraCustomDataFades, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Fade MIDs Created"), STAT_AuraFadeMIDsCreated, STATGROUP_Aura);
+
+int32 FAuraScalarFade::FindCustomDataIndex(const UMaterialInterface* Material, FName ParameterName)
+{
+	FMaterialParameterMetadata ParameterMetadata;
+	if (Material && Material->GetParameterDefaultValue(EMaterialParameterType::Scalar,
+	                                                   FMemoryImageMaterialParameterInfo(ParameterName),
+	                                                   ParameterMetadata))
+	{
+		return ParameterMetadata.PrimitiveDataIndex;
+	}
+	return INDEX_NONE;
+}
+
+int32 FAuraScalarFade::FindFadeDataIndex(const UMaterialInterface* Material, FName ParameterName)
+{
+	FMaterialParameterMetadata ParameterMetadata;
+	if (Material && Material->GetParameterDefaultValue(EMaterialParameterType::Vector,
+	                                                   FMemoryImageMaterialParameterInfo(ParameterName),
+	                                                   ParameterMetadata))
+	{
+		return ParameterMetadata.PrimitiveDataIndex;
+	}
+	return INDEX_NONE;
+}
+
+UMaterialInstanceDynamic* FAuraScalarFade::CreateFallbackMID(UPrimitiveComponent* Primitive,
+                                                             UMaterialInterface* Material, UObject* Outer)
+{
+	INC_DWORD_STAT(STAT_AuraFadeMIDsCreated);
+	UMaterialInstanceDynamic* DynamicMaterialInstance = UMaterialInstanceDynamic::Create(Material, Outer);
+	Primitive->SetMaterial(0, DynamicMaterialInstance);
+	return DynamicMaterialInstance;
+}
+
+void FAuraScalarFade::Start(UPrimitiveComponent* Primitive, int32 DataIndex, float From, float To, float Duration,
+                            double StartTime)
+{
+	check(DataIndex != INDEX_NONE);
+	INC_DWORD_STAT(STAT_AuraCustomDataFades);
+	Primitive->SetCustomPrimitiveDataVector4(
+		DataIndex, FVector4(StartTime, From, To, FMath::Max(Duration, UE_KINDA_SMALL_NUMBER)));
+}
@@ -10,9 +10,9 @@
 #include "AbilitySystem/AuraAttributeSet.h"
 #include "AbilitySystem/Data/AbilityInfo.h"
 #include "AbilitySystem/Data/LevelUpInfo.h"
-#include "AbilitySystem/Debuff/DebuffNiagaraComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
+#include "Game/AuraGameInstance.h"
 #include "Game/AuraGameModeBase.h"
 #include "Game/LoadScreenSaveGame.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -25,6 +25,8 @@
 
 AAuraCharacter::AAuraCharacter()
 {
+	Team = EAuraTeam::Player;
+
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
 
@@ -50,9 +52,11 @@ AAuraCharacter::AAuraCharacter()
 	TopDownCameraComponent->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	TopDownCameraComponent->bUsePawnControlRotation = false;
 
+#if WITH_AURA_COSMETICS
 	LevelUpNiagaraComponent = CreateDefaultSubobject<UNiagaraComponent>("LevelUpNiagaraComponent");
 	LevelUpNiagaraComponent->SetupAttachment(GetRootComponent());
 	LevelUpNiagaraComponent->bAutoActivate = false;
+#endif
 
 	CharacterClass = ECharacterClass::Elementalist;
 }
@@ -69,6 +73,11 @@ void AAuraCharacter::PossessedBy(AController* NewController)
 	{
 		AuraGameMode->LoadWorldState(GetWorld());
 	}
+
+	if (UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(GetGameInstance()))
+	{
+		AuraGameInstance->EndTravel();
+	}
 }
 
 void AAuraCharacter::LoadProgress()
@@ -223,9 +232,9 @@ void AAuraCharacter::HideMagicCircle_Implementation()
 void AAuraCharacter::SaveProgress_Implementation(const FName& CheckpointTag)
 {
 	AAuraGameModeBase* AuraGameMode = Cast<AAuraGameModeBase>(UGameplayStatics::GetGameMode(this));
-	if (AuraGameMode)
+	if (AuraGameMode && HasAuthority())
 	{
-		ULoadScreenSaveGame* SaveData = AuraGameMode->RetrieveInGameSaveData();
+		ULoadScreenSaveGame* SaveData = AuraGameMode->CopyInGameSaveData();
 		if (SaveData == nullptr) return;
 
 		SaveData->PlayerStartTag = CheckpointTag;
@@ -244,8 +253,6 @@ void AAuraCharacter::SaveProgress_Implementation(const FName& CheckpointTag)
 
 		SaveData->bFirstTimeLoadIn = false;
 
-		if (!HasAuthority()) return;
-
 		UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(AbilitySystemComponent);
 		FForEachAbility SaveAbilityDelegate;
 		SaveData->SavedAbilities.Empty();
@@ -318,26 +325,18 @@ void AAuraCharacter::OnRep_Stunned()
 		if (bIsStunned)
 		{
 			AuraASC->AddLooseGameplayTags(BlockedTags);
-			StunDebuffComponent->Activate();
 		}
 		else
 		{
 			AuraASC->RemoveLooseGameplayTags(BlockedTags);
-			StunDebuffComponent->Deactivate();
 		}
+		SetStatusEffectActive(GameplayTags.Debuff_Stun, bIsStunned);
 	}
 }
 
 void AAuraCharacter::OnRep_Burned()
 {
-	if (bIsBurned)
-	{
-		BurnDebuffComponent->Activate();
-	}
-	else
-	{
-		BurnDebuffComponent->Deactivate();
-	}
+	SetStatusEffectActive(FAuraGameplayTags::Get().Debuff_Burn, bIsBurned);
 }
 
 void AAuraCharacter::SetTargetArmLength(float value) const
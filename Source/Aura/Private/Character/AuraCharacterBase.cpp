@@ -3,28 +3,21 @@
 
 #include "Character/AuraCharacterBase.h"
 #include "AbilitySystemComponent.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
 #include "AuraGameplayTags.h"
 #include "AbilitySystem/AuraAbilitySystemComponent.h"
-#include "AbilitySystem/Debuff/DebuffNiagaraComponent.h"
-#include "AbilitySystem/Passive/PassiveNiagaraComponent.h"
+#include "Actor/AuraScalarFade.h"
 #include "Aura/Aura.h"
 #include "Components/CapsuleComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "Game/AuraCorpseSubsystem.h"
+#include "Game/AuraEffectsSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Net/UnrealNetwork.h"
 
 AAuraCharacterBase::AAuraCharacterBase()
 {
-	PrimaryActorTick.bCanEverTick = true;
-	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
-
-	BurnDebuffComponent = CreateDefaultSubobject<UDebuffNiagaraComponent>("BurnDebuffComponent");
-	BurnDebuffComponent->SetupAttachment(GetRootComponent());
-	BurnDebuffComponent->DebuffTag = GameplayTags.Debuff_Burn;
-
-	StunDebuffComponent = CreateDefaultSubobject<UDebuffNiagaraComponent>("StunDebuffComponent");
-	StunDebuffComponent->SetupAttachment(GetRootComponent());
-	StunDebuffComponent->DebuffTag = GameplayTags.Debuff_Stun;
+	PrimaryActorTick.bCanEverTick = false;
 
 	GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
 	GetCapsuleComponent()->SetGenerateOverlapEvents(false);
@@ -36,20 +29,12 @@ AAuraCharacterBase::AAuraCharacterBase()
 	Weapon->SetupAttachment(GetMesh(), FName("WeaponHandSocket"));
 	Weapon->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
+#if WITH_AURA_COSMETICS
 	EffectAttachComponent = CreateDefaultSubobject<USceneComponent>("EffectAttachPoint");
 	EffectAttachComponent->SetupAttachment(GetRootComponent());
-	HaloOfProtectionNiagaraComponent = CreateDefaultSubobject<UPassiveNiagaraComponent>("HaloOfProtectionComponent");
-	HaloOfProtectionNiagaraComponent->SetupAttachment(EffectAttachComponent);
-	LifeSiphonNiagaraComponent = CreateDefaultSubobject<UPassiveNiagaraComponent>("LifeSiphonNiagaraComponent");
-	LifeSiphonNiagaraComponent->SetupAttachment(EffectAttachComponent);
-	ManaSiphonNiagaraComponent = CreateDefaultSubobject<UPassiveNiagaraComponent>("ManaSiphonNiagaraComponent");
-	ManaSiphonNiagaraComponent->SetupAttachment(EffectAttachComponent);
-}
-
-void AAuraCharacterBase::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-	EffectAttachComponent->SetWorldRotation(FRotator::ZeroRotator);
+	// Keeps the passive effects world aligned as the character turns without touching the transform every frame
+	EffectAttachComponent->SetUsingAbsoluteRotation(true);
+#endif
 }
 
 void AAuraCharacterBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -92,7 +77,7 @@ FOnDeathSignature& AAuraCharacterBase::GetOnDeathDelegate()
 
 void AAuraCharacterBase::MulticastHandleDeath_Implementation(const FVector& DeathImpulse)
 {
-	UGameplayStatics::PlaySoundAtLocation(this, DeathSound, GetActorLocation(), GetActorRotation());
+	UAuraEffectsSubsystem::PlaySoundAtLocation(this, DeathSound, GetActorLocation(), GetActorRotation());
 
 	Weapon->SetSimulatePhysics(true);
 	Weapon->SetEnableGravity(true);
@@ -108,11 +93,60 @@ void AAuraCharacterBase::MulticastHandleDeath_Implementation(const FVector& Deat
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	Dissolve();
 	bDead = true;
-	BurnDebuffComponent->Deactivate();
-	StunDebuffComponent->Deactivate();
+	ReleaseStatusEffects();
+	if (UAuraCorpseSubsystem* CorpseSubsystem = GetWorld()->GetSubsystem<UAuraCorpseSubsystem>())
+	{
+		CorpseSubsystem->RegisterRagdoll(this);
+	}
 	OnDeathDelegate.Broadcast(this);
 }
 
+void AAuraCharacterBase::RemoveCorpse()
+{
+	Destroy();
+}
+
+void AAuraCharacterBase::ResetRagdoll()
+{
+	const AAuraCharacterBase* Defaults = GetClass()->GetDefaultObject<AAuraCharacterBase>();
+	const USkeletalMeshComponent* DefaultMesh = Defaults->GetMesh();
+	const USkeletalMeshComponent* DefaultWeapon = Defaults->Weapon;
+
+	GetMesh()->SetSimulatePhysics(false);
+	GetMesh()->SetComponentTickEnabled(true);
+	GetMesh()->SetEnableGravity(DefaultMesh->IsGravityEnabled());
+	GetMesh()->SetCollisionEnabled(DefaultMesh->GetCollisionEnabled());
+	GetMesh()->SetCollisionResponseToChannel(ECC_WorldStatic, DefaultMesh->GetCollisionResponseToChannel(ECC_WorldStatic));
+	GetMesh()->AttachToComponent(GetCapsuleComponent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+	GetMesh()->SetRelativeLocationAndRotation(GetBaseTranslationOffset(), GetBaseRotationOffset());
+
+	Weapon->SetSimulatePhysics(false);
+	Weapon->SetComponentTickEnabled(true);
+	Weapon->SetEnableGravity(DefaultWeapon->IsGravityEnabled());
+	Weapon->SetCollisionEnabled(DefaultWeapon->GetCollisionEnabled());
+	Weapon->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, FName("WeaponHandSocket"));
+	Weapon->SetRelativeTransform(DefaultWeapon->GetRelativeTransform());
+
+#if WITH_AURA_COSMETICS
+	GetMesh()->SetMaterial(0, DefaultMesh->GetMaterial(0));
+	Weapon->SetMaterial(0, DefaultWeapon->GetMaterial(0));
+#endif
+
+	GetCapsuleComponent()->SetCollisionEnabled(Defaults->GetCapsuleComponent()->GetCollisionEnabled());
+	bDead = false;
+}
+
+void AAuraCharacterBase::FreezeRagdoll()
+{
+	for (USkeletalMeshComponent* Ragdoll : {GetMesh(), Weapon.Get()})
+	{
+		Ragdoll->SetSimulatePhysics(false);
+		Ragdoll->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		// The pose written by the last simulation step stays as long as the mesh doesn't tick
+		Ragdoll->SetComponentTickEnabled(false);
+	}
+}
+
 void AAuraCharacterBase::StunTagChanged(const FGameplayTag CallbackTag, int32 NewCount)
 {
 	bIsStunned = NewCount > 0;
@@ -130,6 +164,109 @@ void AAuraCharacterBase::OnRep_Burned()
 void AAuraCharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (AbilitySystemComponent)
+	{
+		BindStatusEffects(AbilitySystemComponent);
+	}
+	OnAscRegistered.AddUObject(this, &AAuraCharacterBase::BindStatusEffects);
+}
+
+void AAuraCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleaseStatusEffects();
+	if (bDead)
+	{
+		if (UAuraCorpseSubsystem* CorpseSubsystem = GetWorld()->GetSubsystem<UAuraCorpseSubsystem>())
+		{
+			CorpseSubsystem->UnregisterCorpse(this);
+		}
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAuraCharacterBase::BindStatusEffects(UAbilitySystemComponent* ASC)
+{
+#if WITH_AURA_COSMETICS
+	if (ASC == nullptr || StatusEffectASC == ASC || StatusEffectSystems.IsEmpty()) return;
+	StatusEffectASC = ASC;
+
+	UAuraAbilitySystemComponent* AuraASC = Cast<UAuraAbilitySystemComponent>(ASC);
+	if (AuraASC)
+	{
+		AuraASC->ActivatePassiveEffect.AddUObject(this, &AAuraCharacterBase::OnPassiveActivate);
+	}
+
+	const FGameplayTag EquippedStatus = FAuraGameplayTags::Get().Abilities_Status_Equipped;
+	for (const TPair<FGameplayTag, TObjectPtr<UNiagaraSystem>>& StatusEffect : StatusEffectSystems)
+	{
+		// Debuffs come in as owned tags, passives through ActivatePassiveEffect, a tag is only ever one of the two
+		ASC->RegisterGameplayTagEvent(StatusEffect.Key, EGameplayTagEventType::NewOrRemoved).AddUObject(
+			this, &AAuraCharacterBase::StatusTagChanged);
+		bool bActive = ASC->HasMatchingGameplayTag(StatusEffect.Key);
+		if (AuraASC && AuraASC->bStartupAbilitiesGiven)
+		{
+			bActive |= AuraASC->GetStatusFromAbilityTag(StatusEffect.Key) == EquippedStatus;
+		}
+		if (bActive)
+		{
+			SetStatusEffectActive(StatusEffect.Key, true);
+		}
+	}
+#endif
+}
+
+void AAuraCharacterBase::StatusTagChanged(const FGameplayTag CallbackTag, int32 NewCount)
+{
+	SetStatusEffectActive(CallbackTag, NewCount > 0);
+}
+
+void AAuraCharacterBase::OnPassiveActivate(const FGameplayTag& AbilityTag, bool bActivate)
+{
+	if (StatusEffectSystems.Contains(AbilityTag))
+	{
+		SetStatusEffectActive(AbilityTag, bActivate);
+	}
+}
+
+void AAuraCharacterBase::SetStatusEffectActive(const FGameplayTag& StatusTag, bool bActive)
+{
+#if WITH_AURA_COSMETICS
+	if (bActive)
+	{
+		if (bDead || ActiveStatusEffects.Contains(StatusTag)) return;
+
+		const TObjectPtr<UNiagaraSystem>* System = StatusEffectSystems.Find(StatusTag);
+		if (System == nullptr || *System == nullptr) return;
+
+		if (UNiagaraComponent* Effect = UNiagaraFunctionLibrary::SpawnSystemAttached(
+			*System, EffectAttachComponent, NAME_None, FVector::ZeroVector, FRotator::ZeroRotator,
+			EAttachLocation::KeepRelativeOffset, false, true, ENCPoolMethod::ManualRelease))
+		{
+			ActiveStatusEffects.Add(StatusTag, Effect);
+		}
+	}
+	else
+	{
+		TObjectPtr<UNiagaraComponent> Effect;
+		if (ActiveStatusEffects.RemoveAndCopyValue(StatusTag, Effect) && IsValid(Effect))
+		{
+			Effect->ReleaseToPool();
+		}
+	}
+#endif
+}
+
+void AAuraCharacterBase::ReleaseStatusEffects()
+{
+	for (const TPair<FGameplayTag, TObjectPtr<UNiagaraComponent>>& StatusEffect : ActiveStatusEffects)
+	{
+		if (IsValid(StatusEffect.Value))
+		{
+			StatusEffect.Value->ReleaseToPool();
+		}
+	}
+	ActiveStatusEffects.Reset();
 }
 
 FVector AAuraCharacterBase::GetCombatSocketLocation_Implementation(const FGameplayTag& MontageTag)
@@ -226,6 +363,11 @@ FOnDamageSignature& AAuraCharacterBase::GetOnDamageSignature()
 	return OnDamageDelegate;
 }
 
+FGenericTeamId AAuraCharacterBase::GetGenericTeamId() const
+{
+	return Team == EAuraTeam::None ? FGenericTeamId::NoTeam : FGenericTeamId(static_cast<uint8>(Team));
+}
+
 void AAuraCharacterBase::InitAbilityActorInfo()
 {
 }
@@ -259,17 +401,33 @@ void AAuraCharacterBase::AddCharacterAbilities()
 
 void AAuraCharacterBase::Dissolve()
 {
+#if WITH_AURA_COSMETICS
+	const double StartTime = GetWorld()->GetTimeSeconds();
 	if (IsValid(DissolveMaterialInstance))
 	{
-		UMaterialInstanceDynamic* DynamicMatInst = UMaterialInstanceDynamic::Create(DissolveMaterialInstance, this);
-		GetMesh()->SetMaterial(0, DynamicMatInst);
-		StartDissolveTimeline(DynamicMatInst);
+		GetMesh()->SetMaterial(0, DissolveMaterialInstance);
+		const int32 DataIndex = FAuraScalarFade::FindFadeDataIndex(DissolveMaterialInstance, DissolveParameterName);
+		if (DataIndex != INDEX_NONE)
+		{
+			FAuraScalarFade::Start(GetMesh(), DataIndex, DissolveStartValue, DissolveEndValue, DissolveDuration, StartTime);
+		}
+		else
+		{
+			StartDissolveTimeline(FAuraScalarFade::CreateFallbackMID(GetMesh(), DissolveMaterialInstance, this));
+		}
 	}
 	if (IsValid(WeaponDissolveMaterialInstance))
 	{
-		UMaterialInstanceDynamic* DynamicMatInst = UMaterialInstanceDynamic::Create(
-			WeaponDissolveMaterialInstance, this);
-		Weapon->SetMaterial(0, DynamicMatInst);
-		StartWeaponDissolveTimeline(DynamicMatInst);
+		Weapon->SetMaterial(0, WeaponDissolveMaterialInstance);
+		const int32 DataIndex = FAuraScalarFade::FindFadeDataIndex(WeaponDissolveMaterialInstance, DissolveParameterName);
+		if (DataIndex != INDEX_NONE)
+		{
+			FAuraScalarFade::Start(Weapon, DataIndex, DissolveStartValue, DissolveEndValue, DissolveDuration, StartTime);
+		}
+		else
+		{
+			StartWeaponDissolveTimeline(FAuraScalarFade::CreateFallbackMID(Weapon, WeaponDissolveMaterialInstance, this));
+		}
 	}
+#endif
 }
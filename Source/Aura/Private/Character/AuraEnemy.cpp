@@ -9,14 +9,20 @@
 #include "AbilitySystem/AuraAttributeSet.h"
 #include "AI/AuraAIController.h"
 #include "Aura/Aura.h"
+#include "BrainComponent.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardComponent.h"
 #include "Components/WidgetComponent.h"
+#include "Game/AuraCorpseSubsystem.h"
+#include "Game/AuraEnemyPoolSubsystem.h"
+#include "Game/AuraPickupPoolSubsystem.h"
+#include "Game/AuraRandomSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "UI/Widget/AuraUserWidget.h"
 
 AAuraEnemy::AAuraEnemy()
 {
+	Team = EAuraTeam::Enemy;
 	GetMesh()->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
 
 	AbilitySystemComponent = CreateDefaultSubobject<UAuraAbilitySystemComponent>("AbilitySystemComponent");
@@ -47,9 +53,15 @@ void AAuraEnemy::PossessedBy(AController* NewController)
 
 	if (!HasAuthority()) return;
 	AuraAIController = Cast<AAuraAIController>(NewController);
+	StartBehaviorTree();
+}
+
+void AAuraEnemy::StartBehaviorTree()
+{
 	AuraAIController->GetBlackboardComponent()->InitializeBlackboard(*BehaviorTree->BlackboardAsset);
 	AuraAIController->RunBehaviorTree(BehaviorTree);
 	AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("HitReacting"), false);
+	AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("Dead"), false);
 	AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("RangedAttacker"),
 	                                                           CharacterClass != ECharacterClass::Warrior);
 }
@@ -78,18 +90,114 @@ int32 AAuraEnemy::GetPlayerLevel_Implementation()
 
 void AAuraEnemy::Die(const FVector& DeathImpulse)
 {
-	SetLifeSpan(LifeSpan);
+	if (bReturnToPool)
+	{
+		GetWorldTimerManager().SetTimer(PoolReturnTimer, this, &AAuraEnemy::ReturnToPool, LifeSpan);
+	}
+	else
+	{
+		SetLifeSpan(LifeSpan);
+	}
 
 	if (AuraAIController)
 	{
 		AuraAIController->GetBlackboardComponent()->SetValueAsBool(FName("Dead"), true);
 	}
 
-	SpawnLoot();
+	DropLoot();
 
 	Super::Die(DeathImpulse);
 }
 
+void AAuraEnemy::DropLoot()
+{
+	if (UAuraPickupPoolSubsystem* PickupPool = GetWorld()->GetSubsystem<UAuraPickupPoolSubsystem>())
+	{
+		PickupPool->DropLoot(UAuraAbilitySystemLibrary::GetLootTiers(this), UAuraRandomSubsystem::GetStream(this, this),
+		                     GetActorLocation(), GetActorForwardVector(), Level);
+	}
+}
+
+void AAuraEnemy::RemoveCorpse()
+{
+	if (bReturnToPool)
+	{
+		ReturnToPool();
+	}
+	else
+	{
+		Super::RemoveCorpse();
+	}
+}
+
+void AAuraEnemy::ReturnToPool()
+{
+	GetWorldTimerManager().ClearTimer(PoolReturnTimer);
+	if (UAuraCorpseSubsystem* CorpseSubsystem = GetWorld()->GetSubsystem<UAuraCorpseSubsystem>())
+	{
+		CorpseSubsystem->UnregisterCorpse(this);
+	}
+
+	if (UAuraEnemyPoolSubsystem* EnemyPool = GetWorld()->GetSubsystem<UAuraEnemyPoolSubsystem>())
+	{
+		EnemyPool->ReleaseEnemy(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+void AAuraEnemy::DeactivateForPool()
+{
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+	if (AuraAIController && AuraAIController->GetBrainComponent())
+	{
+		AuraAIController->GetBrainComponent()->StopLogic(TEXT("Returned to pool"));
+	}
+	CombatTarget = nullptr;
+}
+
+void AAuraEnemy::ReviveFromPool(const FTransform& Transform, int32 InLevel, ECharacterClass InCharacterClass)
+{
+	Level = InLevel;
+	CharacterClass = InCharacterClass;
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	MulticastReviveFromPool();
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	AbilitySystemComponent->CancelAllAbilities();
+	AbilitySystemComponent->RemoveActiveEffects(FGameplayEffectQuery());
+	AbilitySystemComponent->ClearAllAbilities();
+	UAuraAbilitySystemLibrary::GiveStartupAbilities(this, AbilitySystemComponent, CharacterClass);
+	InitializeDefaultAttributes();
+
+	bIsStunned = false;
+	bIsBurned = false;
+	bIsBeingShocked = false;
+	bHitReacting = false;
+	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed;
+
+	if (AuraAIController)
+	{
+		StartBehaviorTree();
+	}
+	else
+	{
+		SpawnDefaultController();
+	}
+}
+
+void AAuraEnemy::MulticastReviveFromPool_Implementation()
+{
+	ResetRagdoll();
+}
+
 void AAuraEnemy::SetCombatTarget_Implementation(AActor* InCombatTarget)
 {
 	CombatTarget = InCombatTarget;
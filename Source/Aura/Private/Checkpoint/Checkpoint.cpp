@@ -3,6 +3,7 @@
 
 #include "Checkpoint/Checkpoint.h"
 
+#include "Actor/AuraScalarFade.h"
 #include "Components/SphereComponent.h"
 #include "Game/AuraGameModeBase.h"
 #include "Interaction/PlayerInterface.h"
@@ -52,7 +53,8 @@ void ACheckpoint::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AAct
 			FString MapName = World->GetMapName();
 			MapName.RemoveFromStart(World->StreamingLevelsPrefix);
 
-			AuraGM->SaveWorldState(GetWorld(), MapName);
+			// SaveProgress below writes the slot
+			AuraGM->SaveWorldState(GetWorld(), MapName, false);
 		}
 
 		IPlayerInterface::Execute_SaveProgress(OtherActor, PlayerStartTag);
@@ -91,10 +93,22 @@ void ACheckpoint::UnHighlightActor_Implementation()
 void ACheckpoint::HandleGlowEffects()
 {
 	Sphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	UMaterialInstanceDynamic* DynamicMaterialInstance = UMaterialInstanceDynamic::Create(
-		CheckpointMesh->GetMaterial(0),
-		this
-	);
-	CheckpointMesh->SetMaterial(0, DynamicMaterialInstance);
+
+	UMaterialInstanceDynamic* DynamicMaterialInstance = nullptr;
+#if WITH_AURA_COSMETICS
+	UMaterialInterface* Material = CheckpointMesh->GetMaterial(0);
+	const int32 DataIndex = FAuraScalarFade::FindFadeDataIndex(Material, GlowParameterName);
+	if (DataIndex != INDEX_NONE)
+	{
+		FAuraScalarFade::Start(CheckpointMesh, DataIndex, GlowStartValue, GlowEndValue, GlowDuration,
+		                       GetWorld()->GetTimeSeconds());
+	}
+	else
+	{
+		DynamicMaterialInstance = FAuraScalarFade::CreateFallbackMID(CheckpointMesh, Material, this);
+	}
+#endif
+
+	// Blueprint logic hooked on the checkpoint runs on every build, dedicated servers included
 	CheckpointReached(DynamicMaterialInstance);
 }
@@ -3,7 +3,10 @@
 
 #include "Checkpoint/MapEntrance.h"
 
+#include "Aura/AuraLogChannels.h"
 #include "Components/SphereComponent.h"
+#include "Engine/Engine.h"
+#include "Game/AuraGameInstance.h"
 #include "Game/AuraGameModeBase.h"
 #include "Interaction/PlayerInterface.h"
 #include "Kismet/GameplayStatics.h"
@@ -26,17 +29,75 @@ void AMapEntrance::LoadActor_Implementation()
 void AMapEntrance::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	if (OtherActor->Implements<UPlayerInterface>())
+	if (OtherActor->Implements<UPlayerInterface>() && !bTravelPending)
 	{
 		bReached = true;
+		bTravelPending = true;
+
+		if (UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(UGameplayStatics::GetGameInstance(this)))
+		{
+			AuraGI->BeginTravel();
+		}
+
+		// Stream the destination in while the save below is written in the background
+		LoadPackageAsync(DestinationMap.ToSoftObjectPath().GetLongPackageName(),
+		                 FLoadPackageAsyncDelegate::CreateUObject(this, &AMapEntrance::OnDestinationMapLoaded));
 
 		if (AAuraGameModeBase* AuraGM = Cast<AAuraGameModeBase>(UGameplayStatics::GetGameMode(this)))
 		{
-			AuraGM->SaveWorldState(GetWorld(), DestinationMap.ToSoftObjectPath().GetAssetName());
+			// SaveProgress below writes the slot
+			AuraGM->SaveWorldState(GetWorld(), DestinationMap.ToSoftObjectPath().GetAssetName(), false);
 		}
 
 		IPlayerInterface::Execute_SaveProgress(OtherActor, DestinationPlayerStartTag);
+	}
+}
+
+void AMapEntrance::OnDestinationMapLoaded(const FName& PackageName, UPackage* LoadedPackage,
+	EAsyncLoadingResult::Type Result)
+{
+	if (Result != EAsyncLoadingResult::Succeeded)
+	{
+		UE_LOG(LogAura, Error, TEXT("Failed to load destination map [%s] of [%s]"), *PackageName.ToString(), *GetName());
+		ResetTravel();
+		return;
+	}
+
+	if (UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(UGameplayStatics::GetGameInstance(this)))
+	{
+		AuraGI->PreloadedMap = UWorld::FindWorldInPackage(LoadedPackage);
+	}
+
+	TravelFailureHandle = GEngine->OnTravelFailure().AddUObject(this, &AMapEntrance::OnTravelFailure);
+	UGameplayStatics::OpenLevelBySoftObjectPtr(this, DestinationMap);
+}
+
+void AMapEntrance::OnTravelFailure(UWorld* World, ETravelFailure::Type FailureType, const FString& ErrorString)
+{
+	if (World != GetWorld()) return;
+
+	UE_LOG(LogAura, Error, TEXT("Travel from [%s] failed: %s"), *GetName(), *ErrorString);
+	ResetTravel();
+}
+
+void AMapEntrance::ResetTravel()
+{
+	bTravelPending = false;
+	GEngine->OnTravelFailure().Remove(TravelFailureHandle);
+	TravelFailureHandle.Reset();
 
-		UGameplayStatics::OpenLevelBySoftObjectPtr(this, DestinationMap);
+	if (UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(UGameplayStatics::GetGameInstance(this)))
+	{
+		AuraGI->CancelTravel();
 	}
 }
+
+void AMapEntrance::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GEngine)
+	{
+		GEngine->OnTravelFailure().Remove(TravelFailureHandle);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraCorpseSubsystem.h"
+
+#include "Aura/Aura.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Character/AuraCharacterBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Interaction/EnemyInterface.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Simulating Ragdolls"), STAT_AuraSimulatingRagdolls, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Corpses"), STAT_AuraCorpses, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Ragdolls Frozen"), STAT_AuraRagdollsFrozen, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Corpses Removed Early"), STAT_AuraCorpsesRemovedEarly, STATGROUP_Aura);
+
+void UAuraCorpseSubsystem::RegisterRagdoll(AAuraCharacterBase* Character)
+{
+	Corpses.Add({Character, GetWorld()->GetTimeSeconds(), true});
+	++NumSimulating;
+
+	FreezeOverBudget();
+	RemoveOverBudget();
+
+	if (NumSimulating > 0 && !UpdateTimer.IsValid())
+	{
+		GetWorld()->GetTimerManager().SetTimer(UpdateTimer, this, &UAuraCorpseSubsystem::Update, 0.25f, true);
+	}
+	SET_DWORD_STAT(STAT_AuraSimulatingRagdolls, NumSimulating);
+	SET_DWORD_STAT(STAT_AuraCorpses, Corpses.Num());
+}
+
+void UAuraCorpseSubsystem::UnregisterCorpse(AAuraCharacterBase* Character)
+{
+	const int32 Index = Corpses.IndexOfByPredicate([Character](const FCorpse& Corpse)
+	{
+		return Corpse.Character == Character;
+	});
+	if (Index != INDEX_NONE)
+	{
+		NumSimulating -= Corpses[Index].bSimulating;
+		Corpses.RemoveAt(Index);
+		SET_DWORD_STAT(STAT_AuraSimulatingRagdolls, NumSimulating);
+		SET_DWORD_STAT(STAT_AuraCorpses, Corpses.Num());
+	}
+}
+
+void UAuraCorpseSubsystem::Deinitialize()
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimer);
+	}
+	Super::Deinitialize();
+}
+
+void UAuraCorpseSubsystem::Update()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (int32 i = Corpses.Num() - 1; i >= 0; --i)
+	{
+		FCorpse& Corpse = Corpses[i];
+		if (!Corpse.Character.IsValid())
+		{
+			NumSimulating -= Corpse.bSimulating;
+			Corpses.RemoveAt(i);
+		}
+		else if (Corpse.bSimulating && Now - Corpse.DeathTime >= MaxRagdollTime)
+		{
+			Freeze(Corpse);
+		}
+	}
+
+	if (NumSimulating == 0)
+	{
+		GetWorld()->GetTimerManager().ClearTimer(UpdateTimer);
+	}
+	SET_DWORD_STAT(STAT_AuraSimulatingRagdolls, NumSimulating);
+	SET_DWORD_STAT(STAT_AuraCorpses, Corpses.Num());
+}
+
+void UAuraCorpseSubsystem::FreezeOverBudget()
+{
+	const int32 Budget = GetRagdollBudget();
+	if (NumSimulating <= Budget) return;
+
+	// Every player's view counts, a ragdoll next to any of them is one somebody is watching
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	if (bFreezeFarthestFirst)
+	{
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PlayerController = It->Get();
+			if (PlayerController == nullptr) continue;
+			ViewLocations.Add(PlayerController->PlayerCameraManager
+				                  ? PlayerController->PlayerCameraManager->GetCameraLocation()
+				                  : PlayerController->GetFocalLocation());
+		}
+	}
+	const bool bByDistance = !ViewLocations.IsEmpty();
+
+	while (NumSimulating > Budget)
+	{
+		int32 FreezeIndex = INDEX_NONE;
+		double FreezeDistanceSquared = -1.0;
+		for (int32 i = 0; i < Corpses.Num(); ++i)
+		{
+			const FCorpse& Corpse = Corpses[i];
+			if (!Corpse.bSimulating || !Corpse.Character.IsValid()) continue;
+			if (!bByDistance)
+			{
+				FreezeIndex = i;
+				break;
+			}
+			const FVector CorpseLocation = Corpse.Character->GetActorLocation();
+			double DistanceSquared = TNumericLimits<double>::Max();
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				DistanceSquared = FMath::Min(DistanceSquared, FVector::DistSquared(ViewLocation, CorpseLocation));
+			}
+			if (DistanceSquared > FreezeDistanceSquared)
+			{
+				FreezeIndex = i;
+				FreezeDistanceSquared = DistanceSquared;
+			}
+		}
+		if (FreezeIndex == INDEX_NONE) break;
+		Freeze(Corpses[FreezeIndex]);
+	}
+}
+
+void UAuraCorpseSubsystem::RemoveOverBudget()
+{
+	if (GetWorld()->GetNetMode() == NM_Client) return;
+
+	for (int32 i = 0; i < Corpses.Num() && Corpses.Num() > MaxCorpses;)
+	{
+		AAuraCharacterBase* Character = Corpses[i].Character.Get();
+		if (Character && Character->Implements<UEnemyInterface>())
+		{
+			NumSimulating -= Corpses[i].bSimulating;
+			Corpses.RemoveAt(i);
+			Character->RemoveCorpse();
+			INC_DWORD_STAT(STAT_AuraCorpsesRemovedEarly);
+			continue;
+		}
+		++i;
+	}
+}
+
+void UAuraCorpseSubsystem::Freeze(FCorpse& Corpse)
+{
+	Corpse.Character->FreezeRagdoll();
+	Corpse.bSimulating = false;
+	--NumSimulating;
+	INC_DWORD_STAT(STAT_AuraRagdollsFrozen);
+}
+
+int32 UAuraCorpseSubsystem::GetRagdollBudget() const
+{
+	// Nobody sees the ragdolls of a dedicated server, they only cost it physics time
+	return GetWorld()->GetNetMode() == NM_DedicatedServer ? 0 : MaxSimultaneousRagdolls;
+}
@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraEffectsSubsystem.h"
+
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Aura/Aura.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Effects Spawned"), STAT_AuraEffectsSpawned, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Effects Reused From Pool"), STAT_AuraEffectsReused, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Effects Culled"), STAT_AuraEffectsCulled, STATGROUP_Aura);
+
+namespace AuraEffectsSubsystem
+{
+	/** Put on the pooled components this subsystem hands out, to tell a reused one from a new one */
+	static const FName HandedOutTag("AuraEffectsHandedOut");
+}
+
+UNiagaraComponent* UAuraEffectsSubsystem::SpawnSystemAtLocation(const UObject* WorldContextObject,
+                                                                UNiagaraSystem* System, const FVector& Location,
+                                                                const FRotator& Rotation)
+{
+	if (System == nullptr || WorldContextObject == nullptr) return nullptr;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	UAuraEffectsSubsystem* Effects = World ? World->GetSubsystem<UAuraEffectsSubsystem>() : nullptr;
+	return Effects ? Effects->SpawnSystem(System, Location, Rotation) : nullptr;
+}
+
+void UAuraEffectsSubsystem::PlaySoundAtLocation(const UObject* WorldContextObject, USoundBase* Sound,
+                                                const FVector& Location, const FRotator& Rotation)
+{
+	if (Sound == nullptr || WorldContextObject == nullptr) return;
+
+	const UWorld* World = WorldContextObject->GetWorld();
+	const UAuraEffectsSubsystem* Effects = World ? World->GetSubsystem<UAuraEffectsSubsystem>() : nullptr;
+	if (Effects == nullptr) return;
+
+	if (!Effects->IsNearLocalPlayer(Location))
+	{
+		INC_DWORD_STAT(STAT_AuraEffectsCulled);
+		return;
+	}
+	// One-shot sounds are played as active sounds without a component, there is nothing to pool
+	UGameplayStatics::PlaySoundAtLocation(WorldContextObject, Sound, Location, Rotation);
+}
+
+bool UAuraEffectsSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UAuraEffectsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UNiagaraComponent* UAuraEffectsSubsystem::SpawnSystem(UNiagaraSystem* System, const FVector& Location,
+                                                      const FRotator& Rotation)
+{
+	if (!IsNearLocalPlayer(Location))
+	{
+		INC_DWORD_STAT(STAT_AuraEffectsCulled);
+		return nullptr;
+	}
+
+	TArray<TWeakObjectPtr<UNiagaraComponent>>& Active = ActiveComponents.FindOrAdd(System);
+	Active.RemoveAllSwap([System](const TWeakObjectPtr<UNiagaraComponent>& Component)
+	{
+		return !Component.IsValid() || !Component->IsActive() || Component->GetAsset() != System;
+	});
+	if (Active.Num() >= GetMaxActive(System))
+	{
+		INC_DWORD_STAT(STAT_AuraEffectsCulled);
+		return nullptr;
+	}
+
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+		this, System, Location, Rotation, FVector(1.f), true, true, ENCPoolMethod::AutoRelease);
+	if (Component == nullptr) return nullptr;
+
+	// The pool keeps component tags, so a tagged component was handed out before and came back from the pool
+	if (Component->ComponentHasTag(AuraEffectsSubsystem::HandedOutTag))
+	{
+		INC_DWORD_STAT(STAT_AuraEffectsReused);
+	}
+	else
+	{
+		Component->ComponentTags.Add(AuraEffectsSubsystem::HandedOutTag);
+		INC_DWORD_STAT(STAT_AuraEffectsSpawned);
+	}
+	Active.Add(Component);
+	return Component;
+}
+
+bool UAuraEffectsSubsystem::IsNearLocalPlayer(const FVector& Location) const
+{
+	return IsNearLocalPlayer(GetWorld(), Location, CullDistance);
+}
+
+bool UAuraEffectsSubsystem::IsNearLocalPlayer(const UWorld* World, const FVector& Location, float Distance)
+{
+	// Also what keeps effects off a dedicated server running in PIE, it has no local player
+	const float DistanceSquared = FMath::Square(Distance);
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController == nullptr || !PlayerController->IsLocalController()) continue;
+
+		const FVector ViewLocation = PlayerController->PlayerCameraManager
+			                             ? PlayerController->PlayerCameraManager->GetCameraLocation()
+			                             : PlayerController->GetFocalLocation();
+		if (FVector::DistSquared(ViewLocation, Location) <= DistanceSquared)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 UAuraEffectsSubsystem::GetMaxActive(const UNiagaraSystem* System) const
+{
+	const int32* MaxActive = MaxActivePerSystem.Find(TSoftObjectPtr<UNiagaraSystem>(FSoftObjectPath(System)));
+	return MaxActive ? *MaxActive : DefaultMaxActivePerSystem;
+}
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraEnemyPoolSubsystem.h"
+
+#include "Aura/Aura.h"
+#include "Character/AuraEnemy.h"
+
+DECLARE_CYCLE_STAT(TEXT("Acquire Enemy"), STAT_AuraAcquireEnemy, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemies Spawned"), STAT_AuraEnemiesSpawned, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemies Reused"), STAT_AuraEnemiesReused, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Enemies"), STAT_AuraPooledEnemies, STATGROUP_Aura);
+
+AAuraEnemy* UAuraEnemyPoolSubsystem::AcquireEnemy(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& Transform,
+                                                  int32 Level, ECharacterClass CharacterClass)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraAcquireEnemy);
+	if (EnemyClass == nullptr) return nullptr;
+
+	if (FPooledEnemies* Pooled = FreeEnemies.Find(EnemyClass))
+	{
+		while (!Pooled->Enemies.IsEmpty())
+		{
+			AAuraEnemy* Enemy = Pooled->Enemies.Pop(EAllowShrinking::No);
+			DEC_DWORD_STAT(STAT_AuraPooledEnemies);
+			if (IsValid(Enemy))
+			{
+				Enemy->ReviveFromPool(Transform, Level, CharacterClass);
+				INC_DWORD_STAT(STAT_AuraEnemiesReused);
+				return Enemy;
+			}
+		}
+	}
+
+	AAuraEnemy* Enemy = GetWorld()->SpawnActorDeferred<AAuraEnemy>(
+		EnemyClass, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (Enemy == nullptr) return nullptr;
+
+	Enemy->SetLevel(Level);
+	Enemy->SetCharacterClass(CharacterClass);
+	Enemy->bReturnToPool = true;
+	Enemy->FinishSpawning(Transform);
+	Enemy->SpawnDefaultController();
+	INC_DWORD_STAT(STAT_AuraEnemiesSpawned);
+	return Enemy;
+}
+
+void UAuraEnemyPoolSubsystem::ReleaseEnemy(AAuraEnemy* Enemy)
+{
+	FPooledEnemies& Pooled = FreeEnemies.FindOrAdd(Enemy->GetClass());
+	if (Pooled.Enemies.Num() >= MaxPooledPerClass)
+	{
+		Enemy->Destroy();
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	Pooled.Enemies.Add(Enemy);
+	INC_DWORD_STAT(STAT_AuraPooledEnemies);
+}
@@ -3,3 +3,37 @@
 
 #include "Game/AuraGameInstance.h"
 
+#include "Aura/AuraLogChannels.h"
+#include "Game/AuraSaveGameStorage.h"
+#include "Game/LoadScreenSaveGame.h"
+
+void UAuraGameInstance::BeginTravel()
+{
+	TravelStartTime = FPlatformTime::Seconds();
+	LastTravelSeconds = 0.0;
+}
+
+void UAuraGameInstance::EndTravel()
+{
+	PreloadedMap = nullptr;
+
+	if (TravelStartTime > 0.0)
+	{
+		LastTravelSeconds = FPlatformTime::Seconds() - TravelStartTime;
+		UE_LOG(LogAura, Log, TEXT("Level travel took %.1f ms from map entrance to playable"), LastTravelSeconds * 1000.0);
+		TravelStartTime = 0.0;
+	}
+}
+
+void UAuraGameInstance::CancelTravel()
+{
+	PreloadedMap = nullptr;
+	TravelStartTime = 0.0;
+}
+
+void UAuraGameInstance::Shutdown()
+{
+	FAuraSaveGameStorage::WaitForPendingWrites();
+
+	Super::Shutdown();
+}
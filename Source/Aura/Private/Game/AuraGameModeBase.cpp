@@ -6,20 +6,17 @@
 #include "EngineUtils.h"
 #include "Aura/AuraLogChannels.h"
 #include "Game/AuraGameInstance.h"
+#include "Game/AuraSaveGameArchive.h"
+#include "Game/AuraSaveGameStorage.h"
 #include "Game/LoadScreenSaveGame.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerStart.h"
 #include "Interaction/SaveInterface.h"
 #include "Kismet/GameplayStatics.h"
-#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 #include "UI/ViewModel/MVVM_LoadSlot.h"
 
 bool AAuraGameModeBase::SaveSlotData(UMVVM_LoadSlot* LoadSlot, int32 SlotIndex)
 {
-	if (UGameplayStatics::DoesSaveGameExist(LoadSlot->GetSlotName(), SlotIndex))
-	{
-		UGameplayStatics::DeleteGameInSlot(LoadSlot->GetSlotName(), SlotIndex);
-	}
 	USaveGame* SaveGameObject = UGameplayStatics::CreateSaveGameObject(LoadScreenSaveGameClass);
 	ULoadScreenSaveGame* LoadScreenSaveGame = Cast<ULoadScreenSaveGame>(SaveGameObject);
 
@@ -30,7 +27,7 @@ bool AAuraGameModeBase::SaveSlotData(UMVVM_LoadSlot* LoadSlot, int32 SlotIndex)
 
 	LoadScreenSaveGame->SaveSlotStatus = Taken;
 
-	bool IsSaved = UGameplayStatics::SaveGameToSlot(LoadScreenSaveGame, LoadSlot->GetSlotName(), SlotIndex);
+	bool IsSaved = FAuraSaveGameStorage::SaveGameToSlot(LoadScreenSaveGame, LoadSlot->GetSlotName(), SlotIndex);
 
 	return IsSaved;
 }
@@ -38,9 +35,9 @@ bool AAuraGameModeBase::SaveSlotData(UMVVM_LoadSlot* LoadSlot, int32 SlotIndex)
 ULoadScreenSaveGame* AAuraGameModeBase::GetSaveSlotData(const FString& SlotName, int32 SlotIndex) const
 {
 	USaveGame* SaveGameObject = nullptr;
-	if (UGameplayStatics::DoesSaveGameExist(SlotName, SlotIndex))
+	if (FAuraSaveGameStorage::DoesSaveGameExist(SlotName, SlotIndex))
 	{
-		SaveGameObject = UGameplayStatics::LoadGameFromSlot(SlotName, SlotIndex);
+		SaveGameObject = FAuraSaveGameStorage::LoadGameFromSlot(SlotName, SlotIndex);
 	}
 	else
 	{
@@ -52,20 +49,28 @@ ULoadScreenSaveGame* AAuraGameModeBase::GetSaveSlotData(const FString& SlotName,
 
 void AAuraGameModeBase::DeleteSlot(const FString& SlotName, int32 SlotIndex)
 {
-	if (UGameplayStatics::DoesSaveGameExist(SlotName, SlotIndex))
-	{
-		UGameplayStatics::DeleteGameInSlot(SlotName, SlotIndex);
-	}
+	FAuraSaveGameStorage::DeleteGameInSlot(SlotName, SlotIndex);
 }
 
-ULoadScreenSaveGame* AAuraGameModeBase::RetrieveInGameSaveData()
+ULoadScreenSaveGame* AAuraGameModeBase::RetrieveInGameSaveData() const
 {
 	UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(GetGameInstance());
 
-	const FString InGameLoadSlotName = AuraGameInstance->LoadSlotName;
-	const int32 InGameLoadSlotIndex = AuraGameInstance->LoadSlotIndex;
+	// Only read from disk once per slot, after that the game instance carries the save object across travel
+	if (!IsValid(AuraGameInstance->InGameSaveGame))
+	{
+		const FString InGameLoadSlotName = AuraGameInstance->LoadSlotName;
+		const int32 InGameLoadSlotIndex = AuraGameInstance->LoadSlotIndex;
+
+		AuraGameInstance->InGameSaveGame = GetSaveSlotData(InGameLoadSlotName, InGameLoadSlotIndex);
+	}
+	return AuraGameInstance->InGameSaveGame;
+}
 
-	return GetSaveSlotData(InGameLoadSlotName, InGameLoadSlotIndex);
+ULoadScreenSaveGame* AAuraGameModeBase::CopyInGameSaveData() const
+{
+	const ULoadScreenSaveGame* SaveGame = RetrieveInGameSaveData();
+	return SaveGame ? DuplicateObject<ULoadScreenSaveGame>(SaveGame, GetGameInstance()) : nullptr;
 }
 
 void AAuraGameModeBase::SaveInGameProgressData(ULoadScreenSaveGame* SaveObject)
@@ -75,11 +80,12 @@ void AAuraGameModeBase::SaveInGameProgressData(ULoadScreenSaveGame* SaveObject)
 	const FString InGameLoadSlotName = AuraGameInstance->LoadSlotName;
 	const int32 InGameLoadSlotIndex = AuraGameInstance->LoadSlotIndex;
 	AuraGameInstance->PlayerStartTag = SaveObject->PlayerStartTag;
+	AuraGameInstance->InGameSaveGame = SaveObject;
 
-	UGameplayStatics::SaveGameToSlot(SaveObject, InGameLoadSlotName, InGameLoadSlotIndex);
+	FAuraSaveGameStorage::AsyncSaveGameToSlot(SaveObject, InGameLoadSlotName, InGameLoadSlotIndex);
 }
 
-void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& DestinationMapAssetName) const
+void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& DestinationMapAssetName, bool bWriteToSlot) const
 {
 	FString WorldName = World->GetMapName();
 	WorldName.RemoveFromStart(World->StreamingLevelsPrefix);
@@ -87,7 +93,7 @@ void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& Destination
 	UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(GetGameInstance());
 	check(AuraGI);
 
-	if (ULoadScreenSaveGame* SaveGame = GetSaveSlotData(AuraGI->LoadSlotName, AuraGI->LoadSlotIndex))
+	if (ULoadScreenSaveGame* SaveGame = RetrieveInGameSaveData())
 	{
 		if (DestinationMapAssetName != FString(""))
 		{
@@ -102,37 +108,43 @@ void AAuraGameModeBase::SaveWorldState(UWorld* World, const FString& Destination
 			SaveGame->SavedMaps.Add(NewSavedMap);
 		}
 
-		FSavedMap SavedMap = SaveGame->GetSavedMapWithMapName(WorldName);
-		SavedMap.SavedActors.Empty(); // clear it out, we'll fill it in with "actors"
+		FSavedMap SavedMap;
+		SavedMap.MapAssetName = WorldName;
 
+		TSet<FName> SavedActorNames;
+		TArray<AActor*> SaveActors;
 		for (FActorIterator It(World); It; ++It)
 		{
 			AActor* Actor = *It;
 
 			if (!IsValid(Actor) || !Actor->Implements<USaveInterface>()) continue;
 
-			FSavedActor SavedActor;
+			bool bAlreadySaved = false;
+			SavedActorNames.Add(Actor->GetFName(), &bAlreadySaved);
+			if (bAlreadySaved) continue;
+
+			FSavedActor& SavedActor = SavedMap.SavedActors.AddDefaulted_GetRef();
 			SavedActor.ActorName = Actor->GetFName();
 			SavedActor.Transform = Actor->GetTransform();
-
-			FMemoryWriter MemoryWriter(SavedActor.Bytes);
-
-			FObjectAndNameAsStringProxyArchive Archive(MemoryWriter, true);
-			Archive.ArIsSaveGame = true;
-
-			Actor->Serialize(Archive);
-
-			SavedMap.SavedActors.AddUnique(SavedActor);
+			SaveActors.Add(Actor);
 		}
 
+		TArray<uint8> RawBytes;
+		FAuraSaveCodec::SerializeActors(SaveActors, SavedMap, RawBytes);
+		FAuraSaveCodec::PackActorBytes(SavedMap, RawBytes, FAuraSaveCodec::GetFormatName(SaveCompression));
+
 		for (FSavedMap& MapToReplace : SaveGame->SavedMaps)
 		{
 			if (MapToReplace.MapAssetName == WorldName)
 			{
-				MapToReplace = SavedMap;
+				MapToReplace = MoveTemp(SavedMap);
+				break;
 			}
 		}
-		UGameplayStatics::SaveGameToSlot(SaveGame, AuraGI->LoadSlotName, AuraGI->LoadSlotIndex);
+		if (bWriteToSlot)
+		{
+			FAuraSaveGameStorage::AsyncSaveGameToSlot(SaveGame, AuraGI->LoadSlotName, AuraGI->LoadSlotIndex);
+		}
 	}
 }
 
@@ -141,42 +153,52 @@ void AAuraGameModeBase::LoadWorldState(UWorld* World) const
 	FString WorldName = World->GetMapName();
 	WorldName.RemoveFromStart(World->StreamingLevelsPrefix);
 
-	UAuraGameInstance* AuraGI = Cast<UAuraGameInstance>(GetGameInstance());
-	check(AuraGI);
+	ULoadScreenSaveGame* SaveGame = RetrieveInGameSaveData();
+	if (SaveGame == nullptr)
+	{
+		UE_LOG(LogAura, Error, TEXT("Failed to load slot"));
+		return;
+	}
 
-	if (UGameplayStatics::DoesSaveGameExist(AuraGI->LoadSlotName, AuraGI->LoadSlotIndex))
+	if (const FSavedMap* FoundMap = SaveGame->FindSavedMap(WorldName))
 	{
+		const FSavedMap& SavedMap = *FoundMap;
 
-		ULoadScreenSaveGame* SaveGame = Cast<ULoadScreenSaveGame>(UGameplayStatics::LoadGameFromSlot(AuraGI->LoadSlotName, AuraGI->LoadSlotIndex));
-		if (SaveGame == nullptr)
+		TArray<uint8> DecompressedBytes;
+		TConstArrayView<uint8> RawBytes;
+		if (!FAuraSaveCodec::UnpackActorBytes(SavedMap, DecompressedBytes, RawBytes))
 		{
-			UE_LOG(LogAura, Error, TEXT("Failed to load slot"));
+			UE_LOG(LogAura, Error, TEXT("Failed to unpack saved actors of map [%s]"), *WorldName);
 			return;
 		}
 
+		TMap<FName, const FSavedActor*> SavedActorsByName;
+		SavedActorsByName.Reserve(SavedMap.SavedActors.Num());
+		for (const FSavedActor& SavedActor : SavedMap.SavedActors)
+		{
+			SavedActorsByName.Add(SavedActor.ActorName, &SavedActor);
+		}
+
 		for (FActorIterator It(World); It; ++It)
 		{
 			AActor* Actor = *It;
 
 			if (!Actor->Implements<USaveInterface>()) continue;
 
-			for (FSavedActor SavedActor : SaveGame->GetSavedMapWithMapName(WorldName).SavedActors)
+			if (const FSavedActor* const* SavedActor = SavedActorsByName.Find(Actor->GetFName()))
 			{
-				if (SavedActor.ActorName == Actor->GetFName())
+				if (ISaveInterface::Execute_ShouldLoadTransform(Actor))
 				{
-					if (ISaveInterface::Execute_ShouldLoadTransform(Actor))
-					{
-						Actor->SetActorTransform(SavedActor.Transform);
-					}
-
-					FMemoryReader MemoryReader(SavedActor.Bytes);
-
-					FObjectAndNameAsStringProxyArchive Archive(MemoryReader, true);
-					Archive.ArIsSaveGame = true;
-					Actor->Serialize(Archive); // converts binary bytes back into variables
+					Actor->SetActorTransform((*SavedActor)->Transform);
+				}
 
-					ISaveInterface::Execute_LoadActor(Actor);
+				if (!FAuraSaveCodec::DeserializeActor(Actor, **SavedActor, SavedMap, RawBytes))
+				{
+					UE_LOG(LogAura, Error, TEXT("Failed to load saved variables of [%s]"), *Actor->GetName());
+					continue;
 				}
+
+				ISaveInterface::Execute_LoadActor(Actor);
 			}
 		}
 	}
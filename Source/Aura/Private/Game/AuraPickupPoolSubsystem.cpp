@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraPickupPoolSubsystem.h"
+
+#include "Actor/AuraEffectActor.h"
+#include "Aura/Aura.h"
+
+DECLARE_CYCLE_STAT(TEXT("Drop Loot"), STAT_AuraDropLoot, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickups Spawned"), STAT_AuraPickupsSpawned, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickups Reused"), STAT_AuraPickupsReused, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Pickups"), STAT_AuraPooledPickups, STATGROUP_Aura);
+
+void UAuraPickupPoolSubsystem::DropLoot(ULootTiers* LootTiers, FRandomStream& Stream, const FVector& Location,
+                                        const FVector& Forward, float Level)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraDropLoot);
+	if (LootTiers == nullptr) return;
+
+	LootTiers->RollLoot(Stream, LootBuffer);
+	const float DeltaAngle = LootBuffer.Num() > 0 ? 360.f / LootBuffer.Num() : 0.f;
+	for (int32 Index = 0; Index < LootBuffer.Num(); ++Index)
+	{
+		const FVector Direction = Forward.RotateAngleAxis(DeltaAngle * Index, FVector::UpVector);
+		const FTransform Transform(Direction.Rotation(), Location + Direction * DropRadius);
+		AActor* Pickup = AcquirePickup(LootBuffer[Index].LootClass, Transform);
+		AAuraEffectActor* EffectActor = Cast<AAuraEffectActor>(Pickup);
+		if (EffectActor && LootBuffer[Index].bLootLevelOverride)
+		{
+			EffectActor->SetActorLevel(Level);
+		}
+	}
+}
+
+AActor* UAuraPickupPoolSubsystem::AcquirePickup(TSubclassOf<AActor> PickupClass, const FTransform& Transform)
+{
+	if (PickupClass == nullptr) return nullptr;
+
+	if (PickupClass->IsChildOf<AAuraEffectActor>())
+	{
+		if (FPooledPickups* Pooled = FreePickups.Find(PickupClass.Get()))
+		{
+			while (!Pooled->Pickups.IsEmpty())
+			{
+				AAuraEffectActor* Pickup = Pooled->Pickups.Pop(EAllowShrinking::No);
+				DEC_DWORD_STAT(STAT_AuraPooledPickups);
+				if (IsValid(Pickup))
+				{
+					Pickup->ActivateFromPool(Transform);
+					INC_DWORD_STAT(STAT_AuraPickupsReused);
+					return Pickup;
+				}
+			}
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Pickup = GetWorld()->SpawnActor<AActor>(PickupClass, Transform, SpawnParams);
+	if (AAuraEffectActor* EffectActor = Cast<AAuraEffectActor>(Pickup))
+	{
+		EffectActor->bReturnToPool = true;
+	}
+	INC_DWORD_STAT(STAT_AuraPickupsSpawned);
+	return Pickup;
+}
+
+void UAuraPickupPoolSubsystem::ReleasePickup(AAuraEffectActor* Pickup)
+{
+	FPooledPickups& Pooled = FreePickups.FindOrAdd(Pickup->GetClass());
+	if (Pooled.Pickups.Num() >= MaxPooledPerClass)
+	{
+		Pickup->Destroy();
+		return;
+	}
+
+	Pickup->DeactivateForPool();
+	Pooled.Pickups.Add(Pickup);
+	INC_DWORD_STAT(STAT_AuraPooledPickups);
+}
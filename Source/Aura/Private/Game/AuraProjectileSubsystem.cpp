@@ -0,0 +1,207 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraProjectileSubsystem.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "NiagaraComponent.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Actor/AuraProjectile.h"
+#include "Actor/AuraProjectileBatch.h"
+#include "Aura/Aura.h"
+#include "Game/AuraEffectsSubsystem.h"
+#include "Game/AuraRandomSubsystem.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Lightweight Projectiles"), STAT_AuraLightweightProjectiles, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Lightweight Projectiles"), STAT_AuraLiveProjectiles, STATGROUP_Aura);
+
+void UAuraProjectileSubsystem::LaunchProjectile(TSubclassOf<AAuraProjectile> ProjectileClass, const FVector& Origin,
+                                                const FVector& Direction, AActor* SourceActor,
+                                                const FDamageEffectParams& DamageEffectParams)
+{
+	if (ProjectileClass == nullptr || Ids.Num() >= MaxProjectiles) return;
+
+	FAuraProjectileLaunch Launch;
+	Launch.Id = NextId++;
+	Launch.ProjectileClass = ProjectileClass;
+	Launch.Origin = Origin;
+	Launch.Direction = Direction.GetSafeNormal();
+	Launch.Speed = ProjectileClass->GetDefaultObject<AAuraProjectile>()->ProjectileMovement->InitialSpeed;
+	Launch.Seed = UAuraRandomSubsystem::GetStream(this, SourceActor).RandHelper(MAX_int32);
+	Launch.SourceActor = SourceActor;
+	AddProjectile(Launch, DamageEffectParams);
+
+	if (Batch == nullptr)
+	{
+		Batch = GetWorld()->SpawnActor<AAuraProjectileBatch>();
+	}
+	Batch->MulticastLaunch(Launch);
+}
+
+void UAuraProjectileSubsystem::AddProjectile(const FAuraProjectileLaunch& Launch,
+                                             const FDamageEffectParams& DamageEffectParams)
+{
+	if (Launch.ProjectileClass == nullptr || IdToIndex.Contains(Launch.Id)) return;
+	const AAuraProjectile* Defaults = Launch.ProjectileClass->GetDefaultObject<AAuraProjectile>();
+
+	IdToIndex.Add(Launch.Id, Ids.Num());
+	Ids.Add(Launch.Id);
+	Locations.Add(Launch.Origin);
+	Velocities.Add(Launch.Direction * Launch.Speed);
+	Radii.Add(Defaults->GetCollisionRadius());
+	EndTimes.Add(GetWorld()->GetTimeSeconds() + Defaults->GetProjectileLifeSpan());
+	Seeds.Add(Launch.Seed);
+	SourceActors.Add(Launch.SourceActor);
+	Trails.Add(UAuraEffectsSubsystem::SpawnSystemAtLocation(this, Defaults->LightweightTrailEffect, Launch.Origin,
+	                                                        Launch.Direction.Rotation()));
+	ProjectileClasses.Add(Launch.ProjectileClass);
+	DamageParams.Add(DamageEffectParams);
+	INC_DWORD_STAT(STAT_AuraLiveProjectiles);
+}
+
+void UAuraProjectileSubsystem::EndProjectile(uint32 Id, const FVector& Location)
+{
+	if (const int32* Index = IdToIndex.Find(Id))
+	{
+		PlayImpact(*Index, Location);
+		RemoveProjectileAt(*Index);
+	}
+}
+
+void UAuraProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	SweepDelegate.BindUObject(this, &UAuraProjectileSubsystem::OnSweepComplete);
+}
+
+void UAuraProjectileSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraLightweightProjectiles);
+	Super::Tick(DeltaTime);
+
+	ResolveHits();
+
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	ObjectParams.AddObjectTypesToQuery(ECC_Pawn);
+
+	for (int32 Index = Ids.Num() - 1; Index >= 0; --Index)
+	{
+		if (Now >= EndTimes[Index])
+		{
+			RemoveProjectileAt(Index);
+			continue;
+		}
+
+		const FVector Start = Locations[Index];
+		const FVector End = Start + Velocities[Index] * DeltaTime;
+		Locations[Index] = End;
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AuraProjectileSweep), false, SourceActors[Index].Get());
+		World->AsyncSweepByObjectType(EAsyncTraceType::Multi, Start, End, FQuat::Identity, ObjectParams,
+		                              FCollisionShape::MakeSphere(Radii[Index]), QueryParams, &SweepDelegate,
+		                              Ids[Index]);
+
+		if (UNiagaraComponent* Trail = Trails[Index].Get())
+		{
+			Trail->SetWorldLocation(End);
+		}
+	}
+}
+
+TStatId UAuraProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UAuraProjectileSubsystem::OnSweepComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	if (TraceDatum.OutHits.IsEmpty()) return;
+	PendingHits.Add({TraceDatum.UserData, MoveTemp(TraceDatum.OutHits)});
+}
+
+void UAuraProjectileSubsystem::ResolveHits()
+{
+	for (const FPendingHit& PendingHit : PendingHits)
+	{
+		// Already ended by an earlier hit, the server or its life span
+		const int32* FoundIndex = IdToIndex.Find(PendingHit.Id);
+		if (FoundIndex == nullptr) continue;
+		const int32 Index = *FoundIndex;
+
+		for (const FHitResult& Hit : PendingHit.Hits)
+		{
+			AActor* HitActor = Hit.GetActor();
+			if (!IsValidHit(Index, HitActor)) continue;
+
+			PlayImpact(Index, Hit.Location);
+			if (GetWorld()->GetNetMode() != NM_Client)
+			{
+				ApplyHit(Index, HitActor);
+				if (Batch)
+				{
+					Batch->MulticastHit(PendingHit.Id, Hit.Location);
+				}
+			}
+			RemoveProjectileAt(Index);
+			break;
+		}
+	}
+	PendingHits.Reset();
+}
+
+bool UAuraProjectileSubsystem::IsValidHit(int32 Index, AActor* HitActor) const
+{
+	if (HitActor == nullptr) return false;
+	AActor* SourceActor = SourceActors[Index].Get();
+	if (SourceActor == HitActor) return false;
+	return UAuraAbilitySystemLibrary::IsNotFriend(SourceActor, HitActor);
+}
+
+void UAuraProjectileSubsystem::ApplyHit(int32 Index, AActor* HitActor)
+{
+	UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(HitActor);
+	if (TargetASC == nullptr || DamageParams[Index].SourceAbilitySystemComponent == nullptr) return;
+
+	FRandomStream KnockbackStream(Seeds[Index]);
+	const bool bKnockback = KnockbackStream.RandRange(1, 100) < DamageParams[Index].KnockbackChance;
+	AAuraProjectile::ApplyProjectileDamage(DamageParams[Index], TargetASC, Velocities[Index].Rotation(), bKnockback);
+}
+
+void UAuraProjectileSubsystem::PlayImpact(int32 Index, const FVector& Location)
+{
+	const AAuraProjectile* Defaults = ProjectileClasses[Index]->GetDefaultObject<AAuraProjectile>();
+	UAuraEffectsSubsystem::PlaySoundAtLocation(this, Defaults->GetImpactSound(), Location);
+	UAuraEffectsSubsystem::SpawnSystemAtLocation(this, Defaults->GetImpactEffect(), Location);
+}
+
+void UAuraProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	if (UNiagaraComponent* Trail = Trails[Index].Get())
+	{
+		Trail->Deactivate();
+	}
+
+	IdToIndex.Remove(Ids[Index]);
+	const int32 LastIndex = Ids.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IdToIndex[Ids[LastIndex]] = Index;
+	}
+
+	Ids.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Locations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	EndTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Seeds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	SourceActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Trails.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ProjectileClasses.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DamageParams.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	DEC_DWORD_STAT(STAT_AuraLiveProjectiles);
+}
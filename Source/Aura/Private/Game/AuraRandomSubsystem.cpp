@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraRandomSubsystem.h"
+
+#include "Aura/AuraLogChannels.h"
+#include "Engine/World.h"
+
+namespace AuraRandomSubsystem
+{
+#if !UE_BUILD_SHIPPING
+	static TAutoConsoleVariable<int32> CVarSeed(
+		TEXT("Aura.Random.Seed"),
+		0,
+		TEXT("Seed for gameplay rolls in worlds started from now on, overriding the configured one.\n")
+		TEXT("0 keeps the configured seed."));
+#endif
+
+	/** For rolls made outside of a game world */
+	static FRandomStream FallbackStream(FMath::Rand());
+}
+
+FRandomStream& UAuraRandomSubsystem::GetStream(const UObject* WorldContextObject, const UObject* Source)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UAuraRandomSubsystem* Random = World ? World->GetSubsystem<UAuraRandomSubsystem>() : nullptr;
+	if (Random == nullptr) return AuraRandomSubsystem::FallbackStream;
+
+	const TObjectKey<UObject> SourceKey(Source);
+	if (FRandomStream* Stream = Random->Streams.Find(SourceKey))
+	{
+		return *Stream;
+	}
+	// Seeded from the name rather than the object, names come out the same when the world is played again
+	const int32 StreamSeed = MakeStreamSeed(Random->WorldSeed, Source ? Source->GetName() : FString());
+	return Random->Streams.Add(SourceKey, FRandomStream(StreamSeed));
+}
+
+int32 UAuraRandomSubsystem::MakeStreamSeed(int32 WorldSeed, const FString& SourceName)
+{
+	// A hash of the characters, an FName's hash depends on the order names were added to this process's name table
+	return static_cast<int32>(HashCombineFast(static_cast<uint32>(WorldSeed), FCrc::StrCrc32(*SourceName)));
+}
+
+void UAuraRandomSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WorldSeed = Seed;
+#if !UE_BUILD_SHIPPING
+	if (const int32 SeedOverride = AuraRandomSubsystem::CVarSeed.GetValueOnGameThread())
+	{
+		WorldSeed = SeedOverride;
+	}
+#endif
+	if (WorldSeed == 0)
+	{
+		WorldSeed = FMath::Max(1, FMath::Rand());
+	}
+	UE_LOG(LogAura, Log, TEXT("%s gameplay random seed is %d"), *GetWorld()->GetName(), WorldSeed);
+
+	ActorDestroyedHandle = GetWorld()->AddOnActorDestroyedHandler(
+		FOnActorDestroyed::FDelegate::CreateUObject(this, &UAuraRandomSubsystem::OnActorDestroyed));
+}
+
+void UAuraRandomSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	Streams.Empty();
+	Super::Deinitialize();
+}
+
+void UAuraRandomSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	Streams.Remove(TObjectKey<UObject>(Actor));
+}
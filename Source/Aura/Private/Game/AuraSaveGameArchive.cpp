@@ -0,0 +1,322 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraSaveGameArchive.h"
+
+#include "Aura/AuraLogChannels.h"
+#include "Game/LoadScreenSaveGame.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ObjectKey.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+FAuraSaveGameArchive::FAuraSaveGameArchive(FArchive& InInnerArchive, TArray<FName>& InNameTable)
+	: FObjectAndNameAsStringProxyArchive(InInnerArchive, true), NameTable(InNameTable)
+{
+	ArIsSaveGame = true;
+	for (int32 i = 0; i < NameTable.Num(); ++i)
+	{
+		NameToIndex.Add(NameTable[i], i);
+	}
+}
+
+FArchive& FAuraSaveGameArchive::operator<<(FName& N)
+{
+	int32 Index = INDEX_NONE;
+	if (IsLoading())
+	{
+		InnerArchive << Index;
+		if (NameTable.IsValidIndex(Index))
+		{
+			N = NameTable[Index];
+		}
+		else
+		{
+			N = NAME_None;
+			SetError();
+		}
+	}
+	else
+	{
+		if (const int32* FoundIndex = NameToIndex.Find(N))
+		{
+			Index = *FoundIndex;
+		}
+		else
+		{
+			Index = NameTable.Add(N);
+			NameToIndex.Add(N, Index);
+		}
+		InnerArchive << Index;
+	}
+	return *this;
+}
+
+FName FAuraSaveCodec::GetFormatName(ESaveCompression Compression)
+{
+	switch (Compression)
+	{
+	case ESaveCompression::Zlib:
+		return NAME_Zlib;
+	case ESaveCompression::Oodle:
+		return NAME_Oodle;
+	default:
+		return NAME_None;
+	}
+}
+
+namespace AuraSaveCodec
+{
+	static TAutoConsoleVariable<int32> CVarSaveSerializeChunks(
+		TEXT("Aura.Save.SerializeChunks"),
+		8,
+		TEXT("Number of chunks the actor serialization of a save is split into, each one a ParallelFor task.\n")
+		TEXT("This is not a thread count: the chunks run on whichever task graph workers are free.\n")
+		TEXT("0 serializes the live actors on the game thread, 1 serializes the snapshots on the game thread."));
+
+	/** SaveGame properties of a class, the only ones a snapshot holds */
+	static const TArray<FProperty*>& GetSaveGameProperties(UClass* Class)
+	{
+		static TMap<TObjectKey<UClass>, TArray<FProperty*>> SaveGamePropertiesByClass;
+		TArray<FProperty*>* Properties = SaveGamePropertiesByClass.Find(Class);
+		if (!Properties)
+		{
+			Properties = &SaveGamePropertiesByClass.Add(Class);
+			for (TFieldIterator<FProperty> It(Class); It; ++It)
+			{
+				if (It->HasAnyPropertyFlags(CPF_SaveGame))
+				{
+					Properties->Add(*It);
+				}
+			}
+		}
+		return *Properties;
+	}
+
+	/**
+	 * Copy of the SaveGame variables of an actor, taken on the game thread so it can be serialized on any thread.
+	 * Data has the layout of the actor class but only the SaveGame properties are constructed in it, the rest is zeroed
+	 * memory that SerializeTaggedProperties never reads since the archive is a SaveGame one.
+	 */
+	struct FActorSnapshot
+	{
+		UClass* Class = nullptr;
+		const TArray<FProperty*>* Properties = nullptr;
+		uint8* Data = nullptr;
+		uint8* Defaults = nullptr;
+		TArray<uint8> Bytes;
+		TArray<FName> Names;
+	};
+
+	static void TakeSnapshot(AActor* Actor, FActorSnapshot& Snapshot)
+	{
+		UClass* Class = Actor->GetClass();
+		Snapshot.Class = Class;
+		Snapshot.Properties = &GetSaveGameProperties(Class);
+		Snapshot.Defaults = reinterpret_cast<uint8*>(Actor->GetArchetype());
+		Snapshot.Data = static_cast<uint8*>(FMemory::MallocZeroed(Class->GetStructureSize(), Class->GetMinAlignment()));
+
+		for (const FProperty* Property : *Snapshot.Properties)
+		{
+			Property->InitializeValue_InContainer(Snapshot.Data);
+			Property->CopyCompleteValue_InContainer(Snapshot.Data, Actor);
+		}
+	}
+
+	static void ReleaseSnapshot(FActorSnapshot& Snapshot)
+	{
+		for (const FProperty* Property : *Snapshot.Properties)
+		{
+			Property->DestroyValue_InContainer(Snapshot.Data);
+		}
+		FMemory::Free(Snapshot.Data);
+		Snapshot.Data = nullptr;
+	}
+
+	static void SerializeProperties(UClass* Class, uint8* Data, uint8* Defaults, TArray<uint8>& OutBytes, TArray<FName>& OutNames)
+	{
+		FMemoryWriter MemoryWriter(OutBytes);
+		FAuraSaveGameArchive Archive(MemoryWriter, OutNames);
+		Class->SerializeTaggedProperties(Archive, Data, Class, Defaults);
+	}
+
+	/** Appends the bytes of one actor to the map buffer and remaps its local name indices into the map's NameTable */
+	static void AppendActor(FSavedActor& SavedActor, FSavedMap& SavedMap, TMap<FName, int32>& MapNameToIndex,
+	                        TArray<uint8>& RawBytes, const TArray<uint8>& ActorBytes, const TArray<FName>& ActorNames)
+	{
+		SavedActor.BytesOffset = RawBytes.Num();
+		SavedActor.BytesNum = ActorBytes.Num();
+		RawBytes.Append(ActorBytes);
+
+		SavedActor.NameIndices.Reset(ActorNames.Num());
+		for (const FName& Name : ActorNames)
+		{
+			int32 MapIndex;
+			if (const int32* FoundIndex = MapNameToIndex.Find(Name))
+			{
+				MapIndex = *FoundIndex;
+			}
+			else
+			{
+				MapIndex = SavedMap.NameTable.Add(Name);
+				MapNameToIndex.Add(Name, MapIndex);
+			}
+			SavedActor.NameIndices.Add(MapIndex);
+		}
+	}
+
+	static TMap<FName, int32> MakeNameToIndex(const FSavedMap& SavedMap)
+	{
+		TMap<FName, int32> MapNameToIndex;
+		for (int32 i = 0; i < SavedMap.NameTable.Num(); ++i)
+		{
+			MapNameToIndex.Add(SavedMap.NameTable[i], i);
+		}
+		return MapNameToIndex;
+	}
+}
+
+void FAuraSaveCodec::SerializeActors(TConstArrayView<AActor*> Actors, FSavedMap& SavedMap, TArray<uint8>& RawBytes)
+{
+	using namespace AuraSaveCodec;
+
+	check(IsInGameThread());
+	check(Actors.Num() == SavedMap.SavedActors.Num());
+
+	const int32 RequestedChunks = CVarSaveSerializeChunks.GetValueOnGameThread();
+	if (RequestedChunks <= 0)
+	{
+		SerializeActorsSerial(Actors, SavedMap, RawBytes);
+		return;
+	}
+
+	TArray<FActorSnapshot> Snapshots;
+	Snapshots.SetNum(Actors.Num());
+	for (int32 i = 0; i < Actors.Num(); ++i)
+	{
+		TakeSnapshot(Actors[i], Snapshots[i]);
+	}
+
+	const int32 NumChunks = FMath::Clamp(RequestedChunks, 1, FMath::Max(Actors.Num(), 1));
+	const int32 ChunkSize = FMath::DivideAndRoundUp(Actors.Num(), NumChunks);
+	ParallelFor(NumChunks, [&Snapshots, ChunkSize](int32 ChunkIndex)
+	{
+		const int32 First = ChunkIndex * ChunkSize;
+		const int32 Last = FMath::Min(First + ChunkSize, Snapshots.Num());
+		for (int32 i = First; i < Last; ++i)
+		{
+			FActorSnapshot& Snapshot = Snapshots[i];
+			SerializeProperties(Snapshot.Class, Snapshot.Data, Snapshot.Defaults, Snapshot.Bytes, Snapshot.Names);
+		}
+	}, NumChunks == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Merging in actor order keeps the output identical to the serial path
+	TMap<FName, int32> MapNameToIndex = MakeNameToIndex(SavedMap);
+	for (int32 i = 0; i < Snapshots.Num(); ++i)
+	{
+		AppendActor(SavedMap.SavedActors[i], SavedMap, MapNameToIndex, RawBytes, Snapshots[i].Bytes, Snapshots[i].Names);
+		ReleaseSnapshot(Snapshots[i]);
+	}
+}
+
+void FAuraSaveCodec::SerializeActorsSerial(TConstArrayView<AActor*> Actors, FSavedMap& SavedMap, TArray<uint8>& RawBytes)
+{
+	using namespace AuraSaveCodec;
+
+	check(Actors.Num() == SavedMap.SavedActors.Num());
+
+	TMap<FName, int32> MapNameToIndex = MakeNameToIndex(SavedMap);
+	TArray<uint8> ActorBytes;
+	TArray<FName> ActorNames;
+	for (int32 i = 0; i < Actors.Num(); ++i)
+	{
+		AActor* Actor = Actors[i];
+		ActorBytes.Reset();
+		ActorNames.Reset();
+		SerializeProperties(Actor->GetClass(), reinterpret_cast<uint8*>(Actor),
+		                    reinterpret_cast<uint8*>(Actor->GetArchetype()), ActorBytes, ActorNames);
+		AppendActor(SavedMap.SavedActors[i], SavedMap, MapNameToIndex, RawBytes, ActorBytes, ActorNames);
+	}
+}
+
+bool FAuraSaveCodec::DeserializeActor(AActor* Actor, const FSavedActor& SavedActor, const FSavedMap& SavedMap,
+                                      TConstArrayView<uint8> RawBytes)
+{
+	if (SavedMap.SaveFormatVersion == 0)
+	{
+		FMemoryReader MemoryReader(SavedActor.Bytes);
+		FObjectAndNameAsStringProxyArchive Archive(MemoryReader, true);
+		Archive.ArIsSaveGame = true;
+		Actor->Serialize(Archive); // converts binary bytes back into variables
+		return !Archive.IsError();
+	}
+
+	if (SavedActor.BytesOffset < 0 || SavedActor.BytesNum < 0 ||
+		SavedActor.BytesOffset + SavedActor.BytesNum > RawBytes.Num())
+	{
+		return false;
+	}
+
+	TArray<FName> ActorNames;
+	ActorNames.Reserve(SavedActor.NameIndices.Num());
+	for (const int32 MapIndex : SavedActor.NameIndices)
+	{
+		if (!SavedMap.NameTable.IsValidIndex(MapIndex)) return false;
+		ActorNames.Add(SavedMap.NameTable[MapIndex]);
+	}
+
+	FMemoryReaderView MemoryReader(RawBytes.Slice(SavedActor.BytesOffset, SavedActor.BytesNum));
+	FAuraSaveGameArchive Archive(MemoryReader, ActorNames);
+	UClass* Class = Actor->GetClass();
+	Class->SerializeTaggedProperties(Archive, reinterpret_cast<uint8*>(Actor), Class,
+	                                 reinterpret_cast<uint8*>(Actor->GetArchetype()), Actor);
+	return !Archive.IsError();
+}
+
+void FAuraSaveCodec::PackActorBytes(FSavedMap& SavedMap, TArray<uint8>& RawBytes, FName FormatName)
+{
+	SavedMap.SaveFormatVersion = CurrentSaveFormatVersion;
+	SavedMap.UncompressedSize = RawBytes.Num();
+	SavedMap.CompressionFormat = NAME_None;
+
+	if (!FormatName.IsNone() && RawBytes.Num() > 0)
+	{
+		int32 CompressedSize = FCompression::CompressMemoryBound(FormatName, RawBytes.Num());
+		TArray<uint8> CompressedBytes;
+		CompressedBytes.SetNumUninitialized(CompressedSize);
+
+		if (FCompression::CompressMemory(FormatName, CompressedBytes.GetData(), CompressedSize, RawBytes.GetData(),
+		                                 RawBytes.Num()) && CompressedSize < RawBytes.Num())
+		{
+			CompressedBytes.SetNum(CompressedSize);
+			SavedMap.ActorBytes = MoveTemp(CompressedBytes);
+			SavedMap.CompressionFormat = FormatName;
+		}
+	}
+
+	if (SavedMap.CompressionFormat.IsNone())
+	{
+		SavedMap.ActorBytes = MoveTemp(RawBytes);
+	}
+
+	UE_LOG(LogAura, Verbose, TEXT("Saved map [%s]: %d actors, %d names, %d bytes raw, %d bytes stored (%s)"),
+	       *SavedMap.MapAssetName, SavedMap.SavedActors.Num(), SavedMap.NameTable.Num(), SavedMap.UncompressedSize,
+	       SavedMap.ActorBytes.Num(), *SavedMap.CompressionFormat.ToString());
+}
+
+bool FAuraSaveCodec::UnpackActorBytes(const FSavedMap& SavedMap, TArray<uint8>& DecompressedBytes,
+                                      TConstArrayView<uint8>& OutRawBytes)
+{
+	if (SavedMap.CompressionFormat.IsNone())
+	{
+		OutRawBytes = SavedMap.ActorBytes;
+		return true;
+	}
+
+	DecompressedBytes.SetNumUninitialized(SavedMap.UncompressedSize);
+	OutRawBytes = DecompressedBytes;
+	return FCompression::UncompressMemory(SavedMap.CompressionFormat, DecompressedBytes.GetData(),
+	                                      DecompressedBytes.Num(), SavedMap.ActorBytes.GetData(),
+	                                      SavedMap.ActorBytes.Num());
+}
@@ -0,0 +1,295 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraSaveGameStorage.h"
+
+#include "Aura/AuraLogChannels.h"
+#include "GameFramework/SaveGame.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Tasks/Pipe.h"
+#include "UObject/Package.h"
+
+namespace AuraSaveGameStorage
+{
+	// Written before the serialized save game. Data starting with anything else was written before the header existed
+	static constexpr uint32 HeaderMagic = 0x48565341; // "ASVH"
+	static constexpr int32 HeaderSize = sizeof(uint32) * 2;
+
+	enum class EStorageVersion : uint32
+	{
+		// Payload written by UGameplayStatics::SaveGameToMemory
+		GameplayStaticsPayload = 1,
+		// Payload written straight after the header, see SerializeWithEnvelope
+		InPlacePayload = 2,
+
+		Latest = InPlacePayload
+	};
+
+	// Appended after the serialized save game, followed by the CRC32 of the header and the save game
+	static constexpr uint32 FooterMagic = 0x41535643; // "ASVC"
+	static constexpr int32 FooterSize = sizeof(uint32) * 2;
+
+#if !UE_BUILD_SHIPPING
+	static TAutoConsoleVariable<bool> CVarSaveSimulateTruncatedWrite(
+		TEXT("Aura.Save.SimulateTruncatedWrite"),
+		false,
+		TEXT("Cuts the next slot write in half, as if the game crashed while writing it. Loading must fall back to the backup."));
+#endif
+
+	static UE::Tasks::FPipe WritePipe{TEXT("AuraSaveGameWrites")};
+	static UE::Tasks::FTask LastWrite;
+
+	static FString GetTempSlotName(const FString& SlotName)
+	{
+		return SlotName + TEXT("_tmp");
+	}
+
+	static FString GetBackupSlotName(const FString& SlotName)
+	{
+		return SlotName + TEXT("_bak");
+	}
+
+	/** File the generic save game system writes a slot to */
+	static FString GetSlotFilePath(const FString& SlotName)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".sav");
+	}
+
+	/**
+	 * Checks the header and footer and returns the payload between them. Data without the header was written before
+	 * checksums and is returned whole, data with it must end with a matching footer, so a write cut short never passes
+	 * as a legacy slot.
+	 */
+	static bool VerifyEnvelope(TConstArrayView<uint8> Data, uint32& OutVersion, TConstArrayView<uint8>& OutPayload)
+	{
+		if (Data.Num() < HeaderSize) return false;
+
+		FMemoryReaderView Reader(Data);
+		uint32 Magic = 0;
+		Reader << Magic << OutVersion;
+		if (Magic != HeaderMagic)
+		{
+			OutVersion = 0;
+			OutPayload = Data;
+			return true;
+		}
+
+		if (OutVersion > static_cast<uint32>(EStorageVersion::Latest))
+		{
+			UE_LOG(LogAura, Warning, TEXT("Save slot storage version %u is newer than %u"), OutVersion,
+			       static_cast<uint32>(EStorageVersion::Latest));
+			return false;
+		}
+		if (Data.Num() < HeaderSize + FooterSize) return false;
+
+		const int32 FooterOffset = Data.Num() - FooterSize;
+		uint32 StoredCrc = 0;
+		Reader.Seek(FooterOffset);
+		Reader << Magic << StoredCrc;
+		if (Magic != FooterMagic || FCrc::MemCrc32(Data.GetData(), FooterOffset) != StoredCrc) return false;
+
+		OutPayload = Data.Slice(HeaderSize, FooterOffset - HeaderSize);
+		return true;
+	}
+
+	/**
+	 * Writes the header, the save game and the footer into Data in one pass, the CRC is taken over the buffer in place.
+	 * The save game is written the way UGameplayStatics::SaveGameToMemory does, with the class, engine and custom
+	 * versions in front, but into the same writer as the header instead of a buffer of its own.
+	 */
+	static bool SerializeWithEnvelope(USaveGame* SaveGameObject, TArray<uint8>& Data)
+	{
+		if (SaveGameObject == nullptr) return false;
+
+		FMemoryWriter Writer(Data, true);
+		uint32 Magic = HeaderMagic;
+		uint32 Version = static_cast<uint32>(EStorageVersion::Latest);
+		Writer << Magic << Version;
+
+		FString SaveGameClassPath = SaveGameObject->GetClass()->GetPathName();
+		FPackageFileVersion PackageVersion = GPackageFileUEVersion;
+		FCustomVersionContainer CustomVersions = FCurrentCustomVersions::GetAll();
+		Writer << SaveGameClassPath << PackageVersion;
+		CustomVersions.Serialize(Writer, ECustomVersionSerializationFormat::Latest);
+
+		FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+		SaveGameObject->Serialize(Ar);
+
+		uint32 Crc = FCrc::MemCrc32(Data.GetData(), Data.Num());
+		Magic = FooterMagic;
+		Writer << Magic << Crc;
+
+#if !UE_BUILD_SHIPPING
+		if (CVarSaveSimulateTruncatedWrite.GetValueOnGameThread())
+		{
+			UE_LOG(LogAura, Warning, TEXT("Simulating a truncated save slot write"));
+			Data.SetNum(Data.Num() / 2);
+		}
+#endif
+
+		return true;
+	}
+
+	/** Reads a save game written by SerializeWithEnvelope, straight from the slot's buffer */
+	static USaveGame* DeserializeInPlace(TConstArrayView<uint8> Payload)
+	{
+		FMemoryReaderView Reader(Payload);
+		FString SaveGameClassPath;
+		FPackageFileVersion PackageVersion;
+		FCustomVersionContainer CustomVersions;
+		Reader << SaveGameClassPath << PackageVersion;
+		CustomVersions.Serialize(Reader, ECustomVersionSerializationFormat::Latest);
+		if (Reader.IsError()) return nullptr;
+		Reader.SetUEVer(PackageVersion);
+		Reader.SetCustomVersions(CustomVersions);
+
+		UClass* SaveGameClass = FindObject<UClass>(nullptr, *SaveGameClassPath);
+		if (SaveGameClass == nullptr)
+		{
+			SaveGameClass = LoadObject<UClass>(nullptr, *SaveGameClassPath);
+		}
+		if (SaveGameClass == nullptr || !SaveGameClass->IsChildOf<USaveGame>()) return nullptr;
+
+		USaveGame* SaveGameObject = NewObject<USaveGame>(GetTransientPackage(), SaveGameClass);
+		FObjectAndNameAsStringProxyArchive Ar(Reader, true);
+		SaveGameObject->Serialize(Ar);
+		return Reader.IsError() ? nullptr : SaveGameObject;
+	}
+
+	/** Writes to the temp slot, then swaps it in and keeps the previous slot as the backup. Safe to call off the game thread */
+	static bool WriteSlotData(const TArray<uint8>& Data, const FString& SlotName, int32 UserIndex)
+	{
+		const FString TempSlotName = GetTempSlotName(SlotName);
+		if (!UGameplayStatics::SaveDataToSlot(Data, TempSlotName, UserIndex)) return false;
+
+		const FString SlotPath = GetSlotFilePath(SlotName);
+		const FString TempPath = GetSlotFilePath(TempSlotName);
+		IFileManager& FileManager = IFileManager::Get();
+		if (!FileManager.FileExists(*TempPath))
+		{
+			// Platform save systems that don't store slots as plain files can't be renamed, write the slot directly
+			UGameplayStatics::DeleteGameInSlot(TempSlotName, UserIndex);
+			return UGameplayStatics::SaveDataToSlot(Data, SlotName, UserIndex);
+		}
+
+		if (FileManager.FileExists(*SlotPath) && !FileManager.Move(*GetSlotFilePath(GetBackupSlotName(SlotName)), *SlotPath))
+		{
+			UE_LOG(LogAura, Error, TEXT("Failed to back up save slot [%s]"), *SlotName);
+			return false;
+		}
+		return FileManager.Move(*SlotPath, *TempPath);
+	}
+
+	static USaveGame* LoadVerified(const FString& SlotName, int32 UserIndex)
+	{
+		TArray<uint8> Data;
+		if (!UGameplayStatics::LoadDataFromSlot(Data, SlotName, UserIndex)) return nullptr;
+
+		uint32 Version = 0;
+		TConstArrayView<uint8> Payload;
+		if (!VerifyEnvelope(Data, Version, Payload))
+		{
+			UE_LOG(LogAura, Warning, TEXT("Save slot [%s] failed its checksum"), *SlotName);
+			return nullptr;
+		}
+		if (Version >= static_cast<uint32>(EStorageVersion::InPlacePayload))
+		{
+			return DeserializeInPlace(Payload);
+		}
+		// Slots written before the in place payload, LoadGameFromMemory only takes a whole array
+		return UGameplayStatics::LoadGameFromMemory(Version == 0 ? Data : TArray<uint8>(Payload));
+	}
+}
+
+bool FAuraSaveGameStorage::SaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, int32 UserIndex)
+{
+	using namespace AuraSaveGameStorage;
+
+	WaitForPendingWrites();
+
+	TArray<uint8> Data;
+	return SerializeWithEnvelope(SaveGameObject, Data) && WriteSlotData(Data, SlotName, UserIndex);
+}
+
+void FAuraSaveGameStorage::AsyncSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, int32 UserIndex)
+{
+	using namespace AuraSaveGameStorage;
+
+	check(IsInGameThread());
+
+	TArray<uint8> Data;
+	if (!SerializeWithEnvelope(SaveGameObject, Data)) return;
+
+	LastWrite = WritePipe.Launch(TEXT("AuraSaveGameWrite"), [Data = MoveTemp(Data), SlotName, UserIndex]()
+	{
+		if (!WriteSlotData(Data, SlotName, UserIndex))
+		{
+			UE_LOG(LogAura, Error, TEXT("Failed to write save slot [%s]"), *SlotName);
+		}
+	});
+}
+
+void FAuraSaveGameStorage::WaitForPendingWrites()
+{
+	using namespace AuraSaveGameStorage;
+
+	// The pipe runs writes in order, so the last one finishing means all of them have
+	if (LastWrite.IsValid())
+	{
+		LastWrite.Wait();
+		LastWrite = UE::Tasks::FTask();
+	}
+}
+
+USaveGame* FAuraSaveGameStorage::LoadGameFromSlot(const FString& SlotName, int32 UserIndex)
+{
+	using namespace AuraSaveGameStorage;
+
+	WaitForPendingWrites();
+
+	if (USaveGame* SaveGameObject = LoadVerified(SlotName, UserIndex))
+	{
+		return SaveGameObject;
+	}
+
+	const FString BackupSlotName = GetBackupSlotName(SlotName);
+	if (UGameplayStatics::DoesSaveGameExist(BackupSlotName, UserIndex))
+	{
+		UE_LOG(LogAura, Warning, TEXT("Loading backup of save slot [%s]"), *SlotName);
+		return LoadVerified(BackupSlotName, UserIndex);
+	}
+	return nullptr;
+}
+
+bool FAuraSaveGameStorage::DoesSaveGameExist(const FString& SlotName, int32 UserIndex)
+{
+	using namespace AuraSaveGameStorage;
+
+	WaitForPendingWrites();
+
+	return UGameplayStatics::DoesSaveGameExist(SlotName, UserIndex) ||
+		UGameplayStatics::DoesSaveGameExist(GetBackupSlotName(SlotName), UserIndex);
+}
+
+void FAuraSaveGameStorage::DeleteGameInSlot(const FString& SlotName, int32 UserIndex)
+{
+	using namespace AuraSaveGameStorage;
+
+	WaitForPendingWrites();
+
+	for (const FString& Name : {SlotName, GetTempSlotName(SlotName), GetBackupSlotName(SlotName)})
+	{
+		if (UGameplayStatics::DoesSaveGameExist(Name, UserIndex))
+		{
+			UGameplayStatics::DeleteGameInSlot(Name, UserIndex);
+		}
+	}
+}
@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/AuraSpawnQueueSubsystem.h"
+
+#include "Actor/AuraEnemySpawnPoint.h"
+#include "Aura/Aura.h"
+#include "Aura/AuraLogChannels.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spawn Queue"), STAT_AuraSpawnQueue, STATGROUP_Aura);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Spawns"), STAT_AuraQueuedSpawns, STATGROUP_Aura);
+
+void UAuraSpawnQueueSubsystem::QueueWave(TConstArrayView<AAuraEnemySpawnPoint*> SpawnPoints,
+                                         const FVector& PriorityLocation)
+{
+	const int32 WaveId = NextWaveId++;
+	FWave& Wave = Waves.Add(WaveId);
+	Wave.StartTime = FPlatformTime::Seconds();
+
+	for (AAuraEnemySpawnPoint* SpawnPoint : SpawnPoints)
+	{
+		if (!IsValid(SpawnPoint)) continue;
+		PendingSpawns.Add({SpawnPoint, FVector::DistSquared(PriorityLocation, SpawnPoint->GetActorLocation()), WaveId});
+		++Wave.Num;
+	}
+	Wave.Remaining = Wave.Num;
+	if (Wave.Num == 0)
+	{
+		Waves.Remove(WaveId);
+		return;
+	}
+
+	PendingSpawns.Sort([](const FPendingSpawn& A, const FPendingSpawn& B)
+	{
+		return A.DistanceSquared > B.DistanceSquared;
+	});
+	SET_DWORD_STAT(STAT_AuraQueuedSpawns, PendingSpawns.Num());
+}
+
+void UAuraSpawnQueueSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraSpawnQueue);
+	Super::Tick(DeltaTime);
+
+	const double FrameStart = FPlatformTime::Seconds();
+	TArray<int32, TInlineAllocator<4>> FrameWaves;
+	int32 NumSpawned = 0;
+	while (!PendingSpawns.IsEmpty() && NumSpawned < MaxSpawnsPerFrame)
+	{
+		if (NumSpawned > 0 && (FPlatformTime::Seconds() - FrameStart) * 1000.0 >= SpawnBudgetMs) break;
+
+		const FPendingSpawn Spawn = PendingSpawns.Pop(EAllowShrinking::No);
+		if (AAuraEnemySpawnPoint* SpawnPoint = Spawn.SpawnPoint.Get())
+		{
+			SpawnPoint->SpawnEnemy();
+		}
+		++NumSpawned;
+		--Waves[Spawn.WaveId].Remaining;
+		FrameWaves.AddUnique(Spawn.WaveId);
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double FrameMs = (Now - FrameStart) * 1000.0;
+	for (const int32 WaveId : FrameWaves)
+	{
+		FWave& Wave = Waves[WaveId];
+		Wave.WorstFrameMs = FMath::Max(Wave.WorstFrameMs, FrameMs);
+		if (Wave.Remaining == 0)
+		{
+			UE_LOG(LogAura, Log, TEXT("Spawn wave of %d enemies completed in %.1f ms, worst frame spent %.2f ms spawning"),
+			       Wave.Num, (Now - Wave.StartTime) * 1000.0, Wave.WorstFrameMs);
+			Waves.Remove(WaveId);
+		}
+	}
+	SET_DWORD_STAT(STAT_AuraQueuedSpawns, PendingSpawns.Num());
+}
+
+TStatId UAuraSpawnQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraSpawnQueueSubsystem, STATGROUP_Tickables);
+}
@@ -15,6 +15,11 @@ FSavedMap ULoadScreenSaveGame::GetSavedMapWithMapName(const FString& InMapName)
 	return FSavedMap();
 }
 
+const FSavedMap* ULoadScreenSaveGame::FindSavedMap(const FString& InMapName) const
+{
+	return SavedMaps.FindByPredicate([&InMapName](const FSavedMap& Map) { return Map.MapAssetName == InMapName; });
+}
+
 bool ULoadScreenSaveGame::HasMap(const FString& InMapName)
 {
 	for (const FSavedMap& Map : SavedMaps)
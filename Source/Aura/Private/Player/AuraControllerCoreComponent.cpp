@@ -0,0 +1,390 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Player/AuraControllerCoreComponent.h"
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AuraGameplayTags.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "Actor/MagicCircle.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Aura/Aura.h"
+#include "Components/DecalComponent.h"
+#include "Components/SplineComponent.h"
+#include "Game/AuraEffectsSubsystem.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Interaction/HighlightInterface.h"
+#include "UI/Widget/DamageTextComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Controller Core Tick"), STAT_AuraControllerCoreTick, STATGROUP_Aura);
+DECLARE_CYCLE_STAT(TEXT("Cursor Trace"), STAT_AuraCursorTrace, STATGROUP_Aura);
+DECLARE_CYCLE_STAT(TEXT("Auto Run"), STAT_AuraAutoRun, STATGROUP_Aura);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Cursor Traces Per Second"), STAT_AuraCursorTracesPerSecond, STATGROUP_Aura);
+
+static TAutoConsoleVariable<float> CVarMaxCursorTraceRate(
+	TEXT("Aura.Controller.MaxCursorTraceRate"),
+	60.f,
+	TEXT("Maximum number of cursor traces per second, 0 traces every frame."));
+
+static TAutoConsoleVariable<float> CVarCursorTraceMaxStaleness(
+	TEXT("Aura.Controller.CursorTraceMaxStaleness"),
+	0.2f,
+	TEXT("Seconds a cursor trace is reused while the cursor and camera don't move, so actors moving under the cursor are still picked up."));
+
+namespace AuraControllerCore
+{
+	/** Implements<UHighlightInterface>() per class, so hit actors don't go through the interface lookup every trace */
+	static bool IsHighlightable(const AActor* Actor)
+	{
+		static TMap<TObjectKey<UClass>, bool> HighlightableClasses;
+
+		if (!IsValid(Actor)) return false;
+
+		UClass* Class = Actor->GetClass();
+		if (const bool* bHighlightable = HighlightableClasses.Find(Class))
+		{
+			return *bHighlightable;
+		}
+		return HighlightableClasses.Add(Class, Class->ImplementsInterface(UHighlightInterface::StaticClass()));
+	}
+}
+
+UAuraControllerCoreComponent::UAuraControllerCoreComponent()
+{
+	// Ticked by the owning controller's PlayerTick so it runs after input, and only for local players
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UAuraControllerCoreComponent::Setup(USplineComponent* InSpline, UNiagaraSystem* InClickNiagaraSystem,
+                                         float InAutoRunAcceptanceRadius,
+                                         TSubclassOf<UDamageTextComponent> InDamageTextComponentClass,
+                                         TSubclassOf<AMagicCircle> InMagicCircleClass)
+{
+	Spline = InSpline;
+	ClickNiagaraSystem = InClickNiagaraSystem;
+	AutoRunAcceptanceRadius = InAutoRunAcceptanceRadius;
+	DamageTextComponentClass = InDamageTextComponentClass;
+	MagicCircleClass = InMagicCircleClass;
+}
+
+void UAuraControllerCoreComponent::PreProcessInput()
+{
+	// Binds the block tag events as soon as the pawn's ASC shows up
+	GetASC();
+}
+
+void UAuraControllerCoreComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (AuraAbilitySystemComponent)
+	{
+		for (const TPair<FGameplayTag, EAuraInputBlock>& BlockTag : GetBlockTags())
+		{
+			AuraAbilitySystemComponent->RegisterGameplayTagEvent(BlockTag.Key, EGameplayTagEventType::NewOrRemoved).RemoveAll(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAuraControllerCoreComponent::PlayerTick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraControllerCoreTick);
+
+	CursorTrace();
+	AutoRun();
+	UpdateMagicCircleLocation();
+}
+
+UAuraAbilitySystemComponent* UAuraControllerCoreComponent::GetASC()
+{
+	if (AuraAbilitySystemComponent == nullptr)
+	{
+		AuraAbilitySystemComponent = Cast<UAuraAbilitySystemComponent>(
+			UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetOwner<APlayerController>()->GetPawn()));
+		if (AuraAbilitySystemComponent)
+		{
+			BindBlockTagEvents();
+		}
+	}
+	return AuraAbilitySystemComponent;
+}
+
+TArray<TPair<FGameplayTag, EAuraInputBlock>, TFixedAllocator<4>> UAuraControllerCoreComponent::GetBlockTags()
+{
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	return {
+		{GameplayTags.Player_Block_InputPressed, EAuraInputBlock::InputPressed},
+		{GameplayTags.Player_Block_InputHeld, EAuraInputBlock::InputHeld},
+		{GameplayTags.Player_Block_InputReleased, EAuraInputBlock::InputReleased},
+		{GameplayTags.Player_Block_CursorTrace, EAuraInputBlock::CursorTrace}
+	};
+}
+
+void UAuraControllerCoreComponent::BindBlockTagEvents()
+{
+	BlockedInputs = EAuraInputBlock::None;
+	for (const TPair<FGameplayTag, EAuraInputBlock>& BlockTag : GetBlockTags())
+	{
+		AuraAbilitySystemComponent->RegisterGameplayTagEvent(BlockTag.Key, EGameplayTagEventType::NewOrRemoved).AddUObject(
+			this, &UAuraControllerCoreComponent::BlockTagChanged, BlockTag.Value);
+		BlockTagChanged(BlockTag.Key, AuraAbilitySystemComponent->GetTagCount(BlockTag.Key), BlockTag.Value);
+	}
+}
+
+void UAuraControllerCoreComponent::BlockTagChanged(const FGameplayTag CallbackTag, int32 NewCount, EAuraInputBlock Block)
+{
+	if (NewCount > 0)
+	{
+		BlockedInputs |= Block;
+	}
+	else
+	{
+		BlockedInputs &= ~Block;
+	}
+}
+
+void UAuraControllerCoreComponent::StopAutoRun()
+{
+	bAutoRunning = false;
+	AbortPathRequest();
+}
+
+void UAuraControllerCoreComponent::FollowCursor(float DeltaSeconds)
+{
+	FollowTime += DeltaSeconds;
+	if (CursorHit.bBlockingHit) CachedDestination = CursorHit.ImpactPoint;
+
+	if (APawn* ControlledPawn = GetOwner<APlayerController>()->GetPawn())
+	{
+		const FVector WorldDirection = (CachedDestination - ControlledPawn->GetActorLocation()).GetSafeNormal();
+		ControlledPawn->AddMovementInput(WorldDirection);
+	}
+}
+
+void UAuraControllerCoreComponent::ReleaseFollowCursor()
+{
+	const APawn* ControlledPawn = GetOwner<APlayerController>()->GetPawn();
+	if (FollowTime <= ShortPressThreshold && ControlledPawn)
+	{
+		if (AuraControllerCore::IsHighlightable(CurrentPointedActor))
+		{
+			IHighlightInterface::Execute_SetMoveToLocation(CurrentPointedActor, CachedDestination);
+		}
+		else if (GetASC() && !IsBlocked(EAuraInputBlock::InputPressed))
+		{
+			UAuraEffectsSubsystem::SpawnSystemAtLocation(this, ClickNiagaraSystem, CachedDestination);
+		}
+		RequestPathToCachedDestination(ControlledPawn);
+	}
+	FollowTime = 0.f;
+}
+
+void UAuraControllerCoreComponent::ShowDamageNumber(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit,
+                                                    bool bCriticalHit) const
+{
+#if WITH_AURA_COSMETICS
+	if (IsValid(TargetCharacter) && DamageTextComponentClass)
+	{
+		UDamageTextComponent* DamageText = NewObject<UDamageTextComponent>(TargetCharacter, DamageTextComponentClass);
+		DamageText->RegisterComponent();
+		DamageText->AttachToComponent(TargetCharacter->GetRootComponent(),
+		                              FAttachmentTransformRules::KeepRelativeTransform);
+		DamageText->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		DamageText->SetDamageText(DamageAmount, bBlockedHit, bCriticalHit);
+	}
+#endif
+}
+
+void UAuraControllerCoreComponent::ShowMagicCircle(UMaterialInterface* DecalMaterial)
+{
+	if (!IsValid(MagicCircle))
+	{
+		MagicCircle = GetWorld()->SpawnActor<AMagicCircle>(MagicCircleClass);
+		if (DecalMaterial)
+		{
+			MagicCircle->MagicCircleDecal->SetMaterial(0, DecalMaterial);
+		}
+	}
+}
+
+void UAuraControllerCoreComponent::HideMagicCircle()
+{
+	if (IsValid(MagicCircle))
+	{
+		MagicCircle->Destroy();
+	}
+}
+
+void UAuraControllerCoreComponent::HighlightActor(AActor* InActor)
+{
+	if (AuraControllerCore::IsHighlightable(InActor))
+	{
+		IHighlightInterface::Execute_HighlightActor(InActor);
+	}
+}
+
+void UAuraControllerCoreComponent::UnHighlightActor(AActor* InActor)
+{
+	if (AuraControllerCore::IsHighlightable(InActor))
+	{
+		IHighlightInterface::Execute_UnHighlightActor(InActor);
+	}
+}
+
+void UAuraControllerCoreComponent::CursorTrace()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraCursorTrace);
+
+	if (IsBlocked(EAuraInputBlock::CursorTrace))
+	{
+		if (TargetActor != PreviousPointedActor) UnHighlightActor(PreviousPointedActor);
+		if (TargetActor != CurrentPointedActor) UnHighlightActor(CurrentPointedActor);
+		if (AuraControllerCore::IsHighlightable(CurrentPointedActor))
+		{
+			PreviousPointedActor = nullptr;
+		}
+		CurrentPointedActor = nullptr;
+		LastCursorTraceTime = -1.0;
+		return;
+	}
+
+	APlayerController* PlayerController = GetOwner<APlayerController>();
+	const double Now = GetWorld()->GetRealTimeSeconds();
+	UpdateCursorTraceRate(Now);
+
+	// The last hit is still valid while neither the cursor nor the camera moved, up to the staleness limit
+	FCursorTraceInputs Inputs;
+	PlayerController->GetMousePosition(Inputs.MouseX, Inputs.MouseY);
+	if (const APlayerCameraManager* CameraManager = PlayerController->PlayerCameraManager)
+	{
+		const FMinimalViewInfo& View = CameraManager->GetCameraCacheView();
+		Inputs.ViewLocation = View.Location;
+		Inputs.ViewRotation = View.Rotation;
+		Inputs.FOV = View.FOV;
+	}
+	Inputs.bMagicCircle = IsValid(MagicCircle);
+
+	const double SinceLastTrace = Now - LastCursorTraceTime;
+	if (LastCursorTraceTime >= 0.0)
+	{
+		if (Inputs == LastCursorTraceInputs && SinceLastTrace < CVarCursorTraceMaxStaleness.GetValueOnGameThread()) return;
+
+		const float MaxTraceRate = CVarMaxCursorTraceRate.GetValueOnGameThread();
+		if (MaxTraceRate > 0.f && SinceLastTrace < 1.0 / MaxTraceRate) return;
+	}
+	LastCursorTraceTime = Now;
+	LastCursorTraceInputs = Inputs;
+	++CursorTraceCount;
+
+	const ECollisionChannel TraceChannel = Inputs.bMagicCircle ? ECC_ExcludePlayers : ECC_Visibility;
+	PlayerController->GetHitResultUnderCursor(TraceChannel, false, CursorHit);
+	if (!CursorHit.bBlockingHit) return;
+
+	PreviousPointedActor = CurrentPointedActor;
+	if (AuraControllerCore::IsHighlightable(CursorHit.GetActor()))
+	{
+		CurrentPointedActor = CursorHit.GetActor();
+	}
+	else
+	{
+		CurrentPointedActor = nullptr;
+	}
+
+	if (PreviousPointedActor != CurrentPointedActor)
+	{
+		if (TargetActor != PreviousPointedActor) UnHighlightActor(PreviousPointedActor);
+		HighlightActor(CurrentPointedActor);
+	}
+}
+
+void UAuraControllerCoreComponent::UpdateCursorTraceRate(double Now)
+{
+	if (Now - CursorTraceRateStartTime < 1.0) return;
+
+	SET_FLOAT_STAT(STAT_AuraCursorTracesPerSecond, CursorTraceCount / (Now - CursorTraceRateStartTime));
+	CursorTraceRateStartTime = Now;
+	CursorTraceCount = 0;
+}
+
+void UAuraControllerCoreComponent::AutoRun()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AuraAutoRun);
+
+	if (!bAutoRunning) return;
+	if (APawn* ControlledPawn = GetOwner<APlayerController>()->GetPawn())
+	{
+		FVector Direction;
+		if (PathFollower.Update(Spline, ControlledPawn->GetActorLocation(), AutoRunAcceptanceRadius, Direction))
+		{
+			ControlledPawn->AddMovementInput(Direction);
+		}
+		else
+		{
+			bAutoRunning = false;
+		}
+	}
+}
+
+void UAuraControllerCoreComponent::RequestPathToCachedDestination(const APawn* ControlledPawn)
+{
+	AbortPathRequest();
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+	if (NavData == nullptr) return;
+
+	// Head straight for the destination until the path arrives
+	Spline->ClearSplinePoints();
+	Spline->AddSplinePoint(ControlledPawn->GetActorLocation(), ESplineCoordinateSpace::World);
+	Spline->AddSplinePoint(CachedDestination, ESplineCoordinateSpace::World);
+	PathFollower.Reset();
+	bAutoRunning = true;
+
+	const FPathFindingQuery Query(this, *NavData, ControlledPawn->GetActorLocation(), CachedDestination);
+	PathQueryID = NavSys->FindPathAsync(FNavAgentProperties::DefaultProperties, Query,
+	                                    FNavPathQueryDelegate::CreateUObject(this, &UAuraControllerCoreComponent::OnPathFound));
+}
+
+void UAuraControllerCoreComponent::AbortPathRequest()
+{
+	if (PathQueryID == INVALID_NAVQUERYID) return;
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->AbortAsyncFindPathRequest(PathQueryID);
+	}
+	PathQueryID = INVALID_NAVQUERYID;
+}
+
+void UAuraControllerCoreComponent::OnPathFound(uint32 QueryID, ENavigationQueryResult::Type Result,
+                                               FNavPathSharedPtr NavPath)
+{
+	if (QueryID != PathQueryID) return;
+	PathQueryID = INVALID_NAVQUERYID;
+
+	if (Result != ENavigationQueryResult::Success || !NavPath.IsValid() || NavPath->GetPathPoints().Num() == 0)
+	{
+		bAutoRunning = false;
+		return;
+	}
+
+	Spline->ClearSplinePoints();
+	for (const FNavPathPoint& PathPoint : NavPath->GetPathPoints())
+	{
+		Spline->AddSplinePoint(PathPoint.Location, ESplineCoordinateSpace::World);
+	}
+	CachedDestination = NavPath->GetPathPoints().Last().Location;
+	PathFollower.Reset();
+}
+
+void UAuraControllerCoreComponent::UpdateMagicCircleLocation() const
+{
+	if (IsValid(MagicCircle))
+	{
+		MagicCircle->SetActorLocation(CursorHit.ImpactPoint);
+	}
+}
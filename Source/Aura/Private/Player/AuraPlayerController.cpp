@@ -3,68 +3,49 @@
 
 #include "Player/AuraPlayerController.h"
 
-#include "AbilitySystemBlueprintLibrary.h"
 #include "AuraGameplayTags.h"
 #include "EnhancedInputSubsystems.h"
-#include "NavigationPath.h"
-#include "NavigationSystem.h"
-#include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemComponent.h"
-#include "Actor/MagicCircle.h"
 #include "Aura/Aura.h"
-#include "Components/DecalComponent.h"
 #include "Components/SplineComponent.h"
 #include "Input/AuraInputComponent.h"
 #include "Interaction/EnemyInterface.h"
-#include "GameFramework/Character.h"
-#include "Interaction/HighlightInterface.h"
-#include "UI/Widget/DamageTextComponent.h"
+#include "Player/AuraControllerCoreComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Aura Player Controller Tick"), STAT_AuraPlayerControllerTick, STATGROUP_Aura);
 
 AAuraPlayerController::AAuraPlayerController()
 {
 	bReplicates = true;
 	Spline = CreateDefaultSubobject<USplineComponent>("Spline");
+	ControllerCore = CreateDefaultSubobject<UAuraControllerCoreComponent>("ControllerCore");
 }
 
 void AAuraPlayerController::PlayerTick(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AuraPlayerControllerTick);
+
+	ControllerCore->PreProcessInput();
 	Super::PlayerTick(DeltaTime);
-	CursorTrace();
-	AutoRun();
-	UpdateMagicCircleLocation();
+	ControllerCore->PlayerTick(DeltaTime);
 }
 
 void AAuraPlayerController::ShowMagicCircle(UMaterialInterface* DecalMaterial)
 {
-	if (!IsValid(MagicCircle))
-	{
-		MagicCircle = GetWorld()->SpawnActor<AMagicCircle>(MagicCircleClass);
-		if (DecalMaterial)
-		{
-			MagicCircle->MagicCircleDecal->SetMaterial(0, DecalMaterial);
-		}
-	}
+	ControllerCore->ShowMagicCircle(DecalMaterial);
 }
 
 void AAuraPlayerController::HideMagicCircle()
 {
-	if (IsValid(MagicCircle))
-	{
-		MagicCircle->Destroy();
-	}
+	ControllerCore->HideMagicCircle();
 }
 
 void AAuraPlayerController::ShowDamageNumber_Implementation(float DamageAmount, ACharacter* TargetCharacter,
                                                             bool bBlockedHit, bool bCriticalHit)
 {
-	if (IsValid(TargetCharacter) && DamageTextComponentClass && IsLocalController())
+	if (IsLocalController())
 	{
-		UDamageTextComponent* DamageText = NewObject<UDamageTextComponent>(TargetCharacter, DamageTextComponentClass);
-		DamageText->RegisterComponent();
-		DamageText->AttachToComponent(TargetCharacter->GetRootComponent(),
-		                              FAttachmentTransformRules::KeepRelativeTransform);
-		DamageText->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-		DamageText->SetDamageText(DamageAmount, bBlockedHit, bCriticalHit);
+		ControllerCore->ShowDamageNumber(DamageAmount, TargetCharacter, bBlockedHit, bCriticalHit);
 	}
 }
 
@@ -73,6 +54,9 @@ void AAuraPlayerController::BeginPlay()
 	Super::BeginPlay();
 	check(AuraContext);
 
+	ControllerCore->Setup(Spline, ClickNiagaraSystem, AutoRunAcceptanceRadius, DamageTextComponentClass,
+	                      MagicCircleClass);
+
 	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(
 		GetLocalPlayer()))
 	{
@@ -108,7 +92,7 @@ void AAuraPlayerController::SetupInputComponent()
 
 void AAuraPlayerController::Move(const FInputActionValue& InputActionValue)
 {
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputPressed))
 	{
 		return;
 	}
@@ -129,16 +113,17 @@ void AAuraPlayerController::Move(const FInputActionValue& InputActionValue)
 void AAuraPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 {
 	/** Avoid to execute player actions if player is blocked to do actions */
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputPressed))
 	{
 		return;
 	}
 
 	if (InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
-		if (IsValid(ThisActor))
+		const AActor* PointedActor = ControllerCore->GetCurrentPointedActor();
+		if (IsValid(PointedActor))
 		{
-			TargetingStatus = ThisActor->Implements<UEnemyInterface>()
+			TargetingStatus = PointedActor->Implements<UEnemyInterface>()
 				                  ? ETargetingStatus::TargetingEnemy
 				                  : ETargetingStatus::TargetingNonEnemy;
 		}
@@ -146,55 +131,29 @@ void AAuraPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 		{
 			TargetingStatus = ETargetingStatus::NotTargeting;
 		}
-		bAutoRunning = false;
+		ControllerCore->StopAutoRun();
 	}
-	if (GetASC()) GetASC()->AbilityInputTagPressed(InputTag);
+	if (UAuraAbilitySystemComponent* ASC = ControllerCore->GetASC()) ASC->AbilityInputTagPressed(InputTag);
 }
 
 void AAuraPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 {
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputReleased))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputReleased))
 	{
 		return;
 	}
+	UAuraAbilitySystemComponent* ASC = ControllerCore->GetASC();
 	if (!InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
-		if (GetASC()) GetASC()->AbilityInputTagReleased(InputTag);
+		if (ASC) ASC->AbilityInputTagReleased(InputTag);
 		return;
 	}
 
-	if (GetASC()) GetASC()->AbilityInputTagReleased(InputTag);
+	if (ASC) ASC->AbilityInputTagReleased(InputTag);
 
 	if (TargetingStatus != ETargetingStatus::TargetingEnemy && !bShiftKeyDown)
 	{
-		const APawn* ControlledPawn = GetPawn();
-		if (FollowTime <= ShortPressThreshold && ControlledPawn)
-		{
-			if (IsValid(ThisActor) && ThisActor->Implements<UHighlightInterface>())
-			{
-				IHighlightInterface::Execute_SetMoveToLocation(ThisActor, CachedDestination);
-			}
-			else if (GetASC() && !GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
-			{
-				UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ClickNiagaraSystem, CachedDestination);
-			}
-
-			if (UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(
-				this, ControlledPawn->GetActorLocation(), CachedDestination))
-			{
-				Spline->ClearSplinePoints();
-				for (const FVector& PointLoc : NavPath->PathPoints)
-				{
-					Spline->AddSplinePoint(PointLoc, ESplineCoordinateSpace::World);
-				}
-				if (NavPath->PathPoints.Num() > 0)
-				{
-					CachedDestination = NavPath->PathPoints[NavPath->PathPoints.Num() - 1];
-					bAutoRunning = true;
-				}
-			}
-		}
-		FollowTime = 0.f;
+		ControllerCore->ReleaseFollowCursor();
 		bTargeting = false;
 		TargetingStatus = ETargetingStatus::NotTargeting;
 	}
@@ -203,117 +162,23 @@ void AAuraPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 void AAuraPlayerController::AbilityInputTagHeld(FGameplayTag InputTag)
 {
 	/** Avoid to execute player actions if player is blocked to do actions */
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputHeld))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputHeld))
 	{
 		return;
 	}
+	UAuraAbilitySystemComponent* ASC = ControllerCore->GetASC();
 	if (!InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
-		if (GetASC()) GetASC()->AbilityInputTagHeld(InputTag);
+		if (ASC) ASC->AbilityInputTagHeld(InputTag);
 		return;
 	}
 
 	if (TargetingStatus == ETargetingStatus::TargetingEnemy || bShiftKeyDown)
 	{
-		if (GetASC()) GetASC()->AbilityInputTagHeld(InputTag);
+		if (ASC) ASC->AbilityInputTagHeld(InputTag);
 	}
 	else
 	{
-		FollowTime += GetWorld()->GetDeltaSeconds();
-		if (CursorHit.bBlockingHit) CachedDestination = CursorHit.ImpactPoint;
-
-		if (APawn* ControlledPawn = GetPawn())
-		{
-			const FVector WorldDirection = (CachedDestination - ControlledPawn->GetActorLocation()).GetSafeNormal();
-			ControlledPawn->AddMovementInput(WorldDirection);
-		}
-	}
-}
-
-UAuraAbilitySystemComponent* AAuraPlayerController::GetASC()
-{
-	if (AuraAbilitySystemComponent == nullptr)
-	{
-		AuraAbilitySystemComponent = Cast<UAuraAbilitySystemComponent>(
-			UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetPawn<APawn>()));
-	}
-	return AuraAbilitySystemComponent;
-}
-
-void AAuraPlayerController::AutoRun()
-{
-	if (!bAutoRunning) return;
-	if (APawn* ControlledPawn = GetPawn())
-	{
-		const FVector LocationOnSpline = Spline->FindLocationClosestToWorldLocation(
-			ControlledPawn->GetActorLocation(), ESplineCoordinateSpace::World);
-		const FVector Direction = Spline->FindDirectionClosestToWorldLocation(
-			LocationOnSpline, ESplineCoordinateSpace::World);
-		ControlledPawn->AddMovementInput(Direction);
-
-		const float DistanceToDestination = (LocationOnSpline - CachedDestination).Length();
-		if (DistanceToDestination <= AutoRunAcceptanceRadius)
-		{
-			bAutoRunning = false;
-		}
-	}
-}
-
-void AAuraPlayerController::CursorTrace()
-{
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_CursorTrace))
-	{
-		UnHighlightActor(LastActor);
-		UnHighlightActor(ThisActor);
-		if (IsValid(ThisActor) && ThisActor->Implements<UHighlightInterface>())
-		{
-			LastActor = nullptr;
-		}
-		ThisActor = nullptr;
-		return;
-	}
-
-	const ECollisionChannel TraceChannel = IsValid(MagicCircle) ? ECC_ExcludePlayers : ECC_Visibility;
-	GetHitResultUnderCursor(TraceChannel, false, CursorHit);
-	if (!CursorHit.bBlockingHit) return;
-
-	LastActor = ThisActor;
-	if (IsValid(CursorHit.GetActor()) && CursorHit.GetActor()->Implements<UHighlightInterface>())
-	{
-		ThisActor = CursorHit.GetActor();
-	}
-	else
-	{
-		ThisActor = nullptr;
-	}
-
-	if (LastActor != ThisActor)
-	{
-		UnHighlightActor(LastActor);
-		HighlightActor(ThisActor);
-	}
-}
-
-void AAuraPlayerController::HighlightActor(AActor* InActor)
-{
-	if (IsValid(InActor) && InActor->Implements<UHighlightInterface>())
-	{
-		IHighlightInterface::Execute_HighlightActor(InActor);
-	}
-}
-
-void AAuraPlayerController::UnHighlightActor(AActor* InActor)
-{
-	if (IsValid(InActor) && InActor->Implements<UHighlightInterface>())
-	{
-		IHighlightInterface::Execute_UnHighlightActor(InActor);
-	}
-}
-
-void AAuraPlayerController::UpdateMagicCircleLocation() const
-{
-	if (IsValid(MagicCircle))
-	{
-		MagicCircle->SetActorLocation(CursorHit.ImpactPoint);
+		ControllerCore->FollowCursor(GetWorld()->GetDeltaSeconds());
 	}
 }
@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Player/AuraSplinePathFollower.h"
+
+#include "Components/SplineComponent.h"
+
+namespace AuraSplinePathFollower
+{
+	/** How far along the chord of a segment Location is, unclamped above so passing the end can be detected */
+	static float GetSegmentAlpha(const FVector& Start, const FVector& End, const FVector& Location)
+	{
+		const FVector Segment = End - Start;
+		const double LengthSquared = Segment.SizeSquared();
+		if (LengthSquared <= UE_KINDA_SMALL_NUMBER) return 1.f;
+
+		return FMath::Max(0.f, static_cast<float>(FVector::DotProduct(Location - Start, Segment) / LengthSquared));
+	}
+}
+
+void FAuraSplinePathFollower::Reset()
+{
+	SegmentIndex = 0;
+	SegmentAlpha = 0.f;
+}
+
+bool FAuraSplinePathFollower::Update(const USplineComponent* Spline, const FVector& Location, float AcceptanceRadius,
+                                     FVector& OutDirection)
+{
+	using namespace AuraSplinePathFollower;
+
+	const int32 NumPoints = Spline->GetNumberOfSplinePoints();
+	if (NumPoints < 2) return false;
+
+	// Skip the segments whose end the pawn has already passed
+	SegmentIndex = FMath::Min(SegmentIndex, NumPoints - 2);
+	FVector Start = Spline->GetLocationAtSplinePoint(SegmentIndex, ESplineCoordinateSpace::World);
+	FVector End = Spline->GetLocationAtSplinePoint(SegmentIndex + 1, ESplineCoordinateSpace::World);
+	while (SegmentIndex < NumPoints - 2 && GetSegmentAlpha(Start, End, Location) >= 1.f)
+	{
+		++SegmentIndex;
+		SegmentAlpha = 0.f;
+		Start = End;
+		End = Spline->GetLocationAtSplinePoint(SegmentIndex + 1, ESplineCoordinateSpace::World);
+	}
+	SegmentAlpha = FMath::Clamp(GetSegmentAlpha(Start, End, Location), SegmentAlpha, 1.f);
+
+	// Evaluate the segment's Hermite curve directly instead of going through the spline's key search
+	const FVector StartTangent = Spline->GetLeaveTangentAtSplinePoint(SegmentIndex, ESplineCoordinateSpace::World);
+	const FVector EndTangent = Spline->GetArriveTangentAtSplinePoint(SegmentIndex + 1, ESplineCoordinateSpace::World);
+
+	const FVector LocationOnSpline = FMath::CubicInterp(Start, StartTangent, End, EndTangent, SegmentAlpha);
+	const FVector Destination = Spline->GetLocationAtSplinePoint(NumPoints - 1, ESplineCoordinateSpace::World);
+	if ((LocationOnSpline - Destination).Length() <= AcceptanceRadius) return false;
+
+	OutDirection = FMath::CubicInterpDerivative(Start, StartTangent, End, EndTangent, SegmentAlpha).GetSafeNormal();
+	if (OutDirection.IsNearlyZero())
+	{
+		OutDirection = (End - Start).GetSafeNormal();
+	}
+	return true;
+}
@@ -3,69 +3,52 @@
 
 #include "Player/MMORPGPlayerController.h"
 
-#include "AbilitySystemBlueprintLibrary.h"
 #include "AuraGameplayTags.h"
 #include "EnhancedInputSubsystems.h"
-#include "NavigationPath.h"
-#include "NavigationSystem.h"
-#include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemComponent.h"
-#include "Actor/MagicCircle.h"
 #include "Aura/Aura.h"
 #include "Character/AuraCharacter.h"
-#include "Components/DecalComponent.h"
 #include "Components/SplineComponent.h"
 #include "GameFramework/Character.h"
 #include "Input/AuraInputComponent.h"
+#include "Interaction/CombatInterface.h"
 #include "Interaction/EnemyInterface.h"
-#include "Interaction/HighlightInterface.h"
-#include "UI/Widget/DamageTextComponent.h"
+#include "Player/AuraControllerCoreComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("MMORPG Player Controller Tick"), STAT_MMORPGPlayerControllerTick, STATGROUP_Aura);
 
 AMMORPGPlayerController::AMMORPGPlayerController()
 {
 	bReplicates = true;
 	Spline = CreateDefaultSubobject<USplineComponent>("Spline");
+	ControllerCore = CreateDefaultSubobject<UAuraControllerCoreComponent>("ControllerCore");
 }
 
 void AMMORPGPlayerController::PlayerTick(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_MMORPGPlayerControllerTick);
+
+	ControllerCore->PreProcessInput();
 	Super::PlayerTick(DeltaTime);
-	CursorTrace();
-	AutoRun();
-	UpdateMagicCircleLocation();
+	ControllerCore->PlayerTick(DeltaTime);
 }
 
 void AMMORPGPlayerController::ShowMagicCircle(UMaterialInterface* DecalMaterial)
 {
-	if (!IsValid(MagicCircle))
-	{
-		MagicCircle = GetWorld()->SpawnActor<AMagicCircle>(MagicCircleClass);
-		if (DecalMaterial)
-		{
-			MagicCircle->MagicCircleDecal->SetMaterial(0, DecalMaterial);
-		}
-	}
+	ControllerCore->ShowMagicCircle(DecalMaterial);
 }
 
 void AMMORPGPlayerController::HideMagicCircle()
 {
-	if (IsValid(MagicCircle))
-	{
-		MagicCircle->Destroy();
-	}
+	ControllerCore->HideMagicCircle();
 }
 
 void AMMORPGPlayerController::ShowDamageNumber_Implementation(float DamageAmount, ACharacter* TargetCharacter,
                                                               bool bBlockedHit, bool bCriticalHit)
 {
-	if (IsValid(TargetCharacter) && DamageTextComponentClass && IsLocalController())
+	if (IsLocalController())
 	{
-		UDamageTextComponent* DamageText = NewObject<UDamageTextComponent>(TargetCharacter, DamageTextComponentClass);
-		DamageText->RegisterComponent();
-		DamageText->AttachToComponent(TargetCharacter->GetRootComponent(),
-		                              FAttachmentTransformRules::KeepRelativeTransform);
-		DamageText->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
-		DamageText->SetDamageText(DamageAmount, bBlockedHit, bCriticalHit);
+		ControllerCore->ShowDamageNumber(DamageAmount, TargetCharacter, bBlockedHit, bCriticalHit);
 	}
 }
 
@@ -74,6 +57,8 @@ void AMMORPGPlayerController::BeginPlay()
 	Super::BeginPlay();
 	check(DefaultMappingContext);
 
+	ControllerCore->Setup(Spline, ClickDecal, AutoRunAcceptanceRadius, DamageTextComponentClass, MagicCircleClass);
+
 	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(
 		GetLocalPlayer()))
 	{
@@ -132,7 +117,7 @@ void AMMORPGPlayerController::SetupInputComponent()
 
 void AMMORPGPlayerController::Move(const FInputActionValue& InputActionValue)
 {
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputPressed))
 	{
 		return;
 	}
@@ -168,7 +153,7 @@ void AMMORPGPlayerController::Look(const FInputActionValue& Value)
 
 void AMMORPGPlayerController::Jump(const FInputActionValue& Value)
 {
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputPressed))
 	{
 		return;
 	}
@@ -199,92 +184,68 @@ void AMMORPGPlayerController::UpdateTargetArmLength(const FInputActionValue& Val
 void AMMORPGPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 {
 	/** Avoid to execute player actions if player is blocked to do actions */
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputPressed))
 	{
 		return;
 	}
 
 	if (InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
-		if (IsValid(CurrentPointedActor))
+		const AActor* PointedActor = ControllerCore->GetCurrentPointedActor();
+		if (IsValid(PointedActor))
 		{
-			TargetingStatus = CurrentPointedActor->Implements<UEnemyInterface>()
+			TargetingStatus = PointedActor->Implements<UEnemyInterface>()
 				                  ? ETargetingStatus::TargetingEnemy
 				                  : ETargetingStatus::TargetingNonEnemy;
 
-			bTargeting = CurrentPointedActor->Implements<UEnemyInterface>();
+			bTargeting = PointedActor->Implements<UEnemyInterface>();
 		}
 		else
 		{
 			TargetingStatus = ETargetingStatus::NotTargeting;
 			bTargeting = false;
 		}
-		bAutoRunning = false;
+		ControllerCore->StopAutoRun();
 	}
 
-	if (IsValid(TargetActor))
+	if (IsValid(GetTargetActor()))
 	{
-		if (GetASC()) GetASC()->AbilityInputTagPressed(InputTag);
+		if (UAuraAbilitySystemComponent* ASC = ControllerCore->GetASC()) ASC->AbilityInputTagPressed(InputTag);
 	}
 }
 
 void AMMORPGPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 {
 	/** Avoid to execute player actions if player is blocked to do actions */
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputReleased))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputReleased))
 	{
 		return;
 	}
+	UAuraAbilitySystemComponent* ASC = ControllerCore->GetASC();
 	if (!InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
-		if (GetASC()) GetASC()->AbilityInputTagReleased(InputTag);
+		if (ASC) ASC->AbilityInputTagReleased(InputTag);
 	}
 	else
 	{
 		if (TargetingStatus != ETargetingStatus::TargetingEnemy && !bShiftKeyDown)
 		{
-			const APawn* ControlledPawn = GetPawn();
-			if (InputElapsedTimeHeld <= ShortPressThreshold && ControlledPawn)
-			{
-				if (IsValid(CurrentPointedActor) && CurrentPointedActor->Implements<UHighlightInterface>())
-				{
-					IHighlightInterface::Execute_SetMoveToLocation(CurrentPointedActor, CachedDestination);
-				}
-				else if (GetASC() && !GetASC()->HasMatchingGameplayTag(
-					FAuraGameplayTags::Get().Player_Block_InputPressed))
-				{
-					UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ClickDecal, CachedDestination);
-				}
-				if (UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(
-					this, ControlledPawn->GetActorLocation(), CachedDestination))
-				{
-					Spline->ClearSplinePoints();
-					for (const FVector& PointLoc : NavPath->PathPoints)
-					{
-						Spline->AddSplinePoint(PointLoc, ESplineCoordinateSpace::World);
-					}
-					if (NavPath->PathPoints.Num() > 0)
-					{
-						CachedDestination = NavPath->PathPoints[NavPath->PathPoints.Num() - 1];
-						bAutoRunning = true;
-					}
-				}
-			}
-			InputElapsedTimeHeld = 0.f;
+			ControllerCore->ReleaseFollowCursor();
 			TargetingStatus = ETargetingStatus::NotTargeting;
 			bTargeting = false;
 		}
 		else
 		{
-			if (IsValid(CurrentPointedActor))
+			AActor* PointedActor = ControllerCore->GetCurrentPointedActor();
+			if (IsValid(PointedActor))
 			{
-				if (CurrentPointedActor != TargetActor)
+				if (PointedActor != GetTargetActor())
 				{
-					UnHighlightActor(TargetActor);
-					TargetActor = CurrentPointedActor;
+					UAuraControllerCoreComponent::UnHighlightActor(GetTargetActor());
+					ControllerCore->SetTargetActor(PointedActor);
 
 
-					if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(TargetActor))
+					if (ICombatInterface* CombatInterface = Cast<ICombatInterface>(PointedActor))
 					{
 						if (!CombatInterface->GetOnDeathDelegate().IsAlreadyBound(
 							this, &AMMORPGPlayerController::TargetActorDied))
@@ -294,13 +255,13 @@ void AMMORPGPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 						}
 					}
 
-					OnTargetActorChangedDelegate.Broadcast(TargetActor);
-					HighlightActor(TargetActor);
+					OnTargetActorChangedDelegate.Broadcast(PointedActor);
+					UAuraControllerCoreComponent::HighlightActor(PointedActor);
 				}
 				else
 				{
-					if (GetASC()) GetASC()->AbilityInputTagHeld(InputTag);
-					// if (GetASC()) GetASC()->AbilityInputTagReleased(InputTag);
+					if (ASC) ASC->AbilityInputTagHeld(InputTag);
+					// if (ASC) ASC->AbilityInputTagReleased(InputTag);
 				}
 			}
 		}
@@ -310,124 +271,34 @@ void AMMORPGPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 void AMMORPGPlayerController::AbilityInputTagHeld(FGameplayTag InputTag)
 {
 	/** Avoid to execute player actions if player is blocked to do actions */
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputHeld))
+	if (ControllerCore->IsBlocked(EAuraInputBlock::InputHeld))
 	{
 		return;
 	}
 	if (!InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
-		if (GetASC()) GetASC()->AbilityInputTagHeld(InputTag);
+		if (UAuraAbilitySystemComponent* ASC = ControllerCore->GetASC()) ASC->AbilityInputTagHeld(InputTag);
 	}
 	else
 	{
 		if (TargetingStatus != ETargetingStatus::TargetingEnemy && !bShiftKeyDown)
 		{
-			InputElapsedTimeHeld += GetWorld()->GetDeltaSeconds();
-			if (CursorHit.bBlockingHit) CachedDestination = CursorHit.ImpactPoint;
-
-			if (APawn* ControlledPawn = GetPawn())
-			{
-				const FVector WorldDirection = (CachedDestination - ControlledPawn->GetActorLocation()).GetSafeNormal();
-				ControlledPawn->AddMovementInput(WorldDirection);
-			}
+			ControllerCore->FollowCursor(GetWorld()->GetDeltaSeconds());
 		}
 	}
 }
 
-UAuraAbilitySystemComponent* AMMORPGPlayerController::GetASC()
-{
-	if (EtherniaAbilitySystemComponent == nullptr)
-	{
-		EtherniaAbilitySystemComponent = Cast<UAuraAbilitySystemComponent>(
-			UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(GetPawn<APawn>()));
-	}
-	return EtherniaAbilitySystemComponent;
-}
-
 void AMMORPGPlayerController::TargetActorDied(AActor* DeadActor)
 {
-	if (DeadActor == TargetActor)
-	{
-		TargetActor = nullptr;
-		OnTargetActorChangedDelegate.Broadcast(TargetActor);
-		UnHighlightActor(CurrentPointedActor);
-	}
-}
-
-void AMMORPGPlayerController::AutoRun()
-{
-	if (!bAutoRunning) return;
-	if (APawn* ControlledPawn = GetPawn())
+	if (DeadActor == GetTargetActor())
 	{
-		const FVector LocationOnSpline = Spline->FindLocationClosestToWorldLocation(
-			ControlledPawn->GetActorLocation(), ESplineCoordinateSpace::World);
-		const FVector Direction = Spline->FindDirectionClosestToWorldLocation(
-			LocationOnSpline, ESplineCoordinateSpace::World);
-		ControlledPawn->AddMovementInput(Direction);
-
-		const float DistanceToDestination = (LocationOnSpline - CachedDestination).Length();
-		if (DistanceToDestination <= AutoRunAcceptanceRadius)
-		{
-			bAutoRunning = false;
-		}
+		ControllerCore->SetTargetActor(nullptr);
+		OnTargetActorChangedDelegate.Broadcast(nullptr);
+		UAuraControllerCoreComponent::UnHighlightActor(ControllerCore->GetCurrentPointedActor());
 	}
 }
 
-void AMMORPGPlayerController::CursorTrace()
+AActor* AMMORPGPlayerController::GetTargetActor() const
 {
-	if (GetASC() && GetASC()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_CursorTrace))
-	{
-		if (TargetActor != PreviousPointedActor )  UnHighlightActor(PreviousPointedActor);
-		if (TargetActor != CurrentPointedActor )  UnHighlightActor(CurrentPointedActor);
-		if (IsValid(CurrentPointedActor) && CurrentPointedActor->Implements<UHighlightInterface>())
-		{
-			PreviousPointedActor = nullptr;
-		}
-		CurrentPointedActor = nullptr;
-		return;
-	}
-
-	const ECollisionChannel TraceChannel = IsValid(MagicCircle) ? ECC_ExcludePlayers : ECC_Visibility;
-	GetHitResultUnderCursor(TraceChannel, false, CursorHit);
-	if (!CursorHit.bBlockingHit) return;
-
-	PreviousPointedActor = CurrentPointedActor;
-	if (IsValid(CursorHit.GetActor()) && CursorHit.GetActor()->Implements<UHighlightInterface>())
-	{
-		CurrentPointedActor = CursorHit.GetActor();
-	}
-	else
-	{
-		CurrentPointedActor = nullptr;
-	}
-
-	if (PreviousPointedActor != CurrentPointedActor)
-	{
-		if (TargetActor != PreviousPointedActor )  UnHighlightActor(PreviousPointedActor);
-		HighlightActor(CurrentPointedActor);
-	}
-}
-
-void AMMORPGPlayerController::HighlightActor(AActor* InActor)
-{
-	if (IsValid(InActor) && InActor->Implements<UHighlightInterface>())
-	{
-		IHighlightInterface::Execute_HighlightActor(InActor);
-	}
-}
-
-void AMMORPGPlayerController::UnHighlightActor(AActor* InActor)
-{
-	if (IsValid(InActor) && InActor->Implements<UHighlightInterface>())
-	{
-		IHighlightInterface::Execute_UnHighlightActor(InActor);
-	}
-}
-
-void AMMORPGPlayerController::UpdateMagicCircleLocation() const
-{
-	if (IsValid(MagicCircle))
-	{
-		MagicCircle->SetActorLocation(CursorHit.ImpactPoint);
-	}
+	return ControllerCore->GetTargetActor();
 }
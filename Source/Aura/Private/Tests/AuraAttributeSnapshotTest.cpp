@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Aura/AuraLogChannels.h"
+#include "Character/AuraEnemy.h"
+#include "Game/AuraGameModeBase.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraAttributeSnapshotTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+
+	/** Spawned with AI possession off, BeginPlay initializes its attributes for InCharacterClass at InLevel */
+	static AAuraEnemy* SpawnEnemy(UWorld* World, ECharacterClass InCharacterClass, int32 InLevel)
+	{
+		AAuraEnemy* Enemy = World->SpawnActorDeferred<AAuraEnemy>(AAuraEnemy::StaticClass(), FTransform::Identity, nullptr,
+		                                                          nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		Enemy->SetLevel(InLevel);
+		Enemy->SetCharacterClass(InCharacterClass);
+		Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+		Enemy->FinishSpawning(FTransform::Identity);
+		return Enemy;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAttributeSnapshotParityTest, "Aura.Attributes.SnapshotMatchesEffects",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraAttributeSnapshotParityTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraAttributeSnapshotTest;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+	const AAuraGameModeBase* AuraGameMode = TestWorld.World->GetAuthGameMode<AAuraGameModeBase>();
+	if (!TestNotNull(TEXT("Aura game mode"), AuraGameMode) ||
+		!TestNotNull(TEXT("Character class info"), AuraGameMode->CharacterClassInfo.Get()))
+	{
+		return false;
+	}
+
+	TArray<ECharacterClass> CharacterClasses;
+	AuraGameMode->CharacterClassInfo->CharacterClassInformation.GetKeys(CharacterClasses);
+	for (const ECharacterClass CharacterClass : CharacterClasses)
+	{
+		for (const int32 Level : {1, 2, 5, 10, 20})
+		{
+			// The first enemy of a class and level goes through the effects and caches the snapshot the second one gets
+			const AAuraEnemy* EffectsEnemy = SpawnEnemy(TestWorld.World, CharacterClass, Level);
+			const AAuraEnemy* SnapshotEnemy = SpawnEnemy(TestWorld.World, CharacterClass, Level);
+			const UAbilitySystemComponent* EffectsASC = EffectsEnemy->GetAbilitySystemComponent();
+			const UAbilitySystemComponent* SnapshotASC = SnapshotEnemy->GetAbilitySystemComponent();
+
+			const FAuraAttributeSnapshot* Snapshot = AuraGameMode->AttributeSnapshots.Find(TPair<ECharacterClass, int32>(CharacterClass, Level));
+			if (!TestNotNull(TEXT("Snapshot is cached"), Snapshot)) continue;
+			// Enemy default effects are all instant, a class that isn't cacheable pays for the effects on every spawn
+			TestTrue(FString::Printf(TEXT("Class %d level %d is cacheable"), static_cast<int32>(CharacterClass), Level),
+			         Snapshot->bCacheable);
+
+			TArray<FGameplayAttribute> Attributes;
+			EffectsASC->GetAllAttributes(Attributes);
+			for (const FGameplayAttribute& Attribute : Attributes)
+			{
+				const float EffectsBase = EffectsASC->GetNumericAttributeBase(Attribute);
+				const float SnapshotBase = SnapshotASC->GetNumericAttributeBase(Attribute);
+				const float EffectsValue = EffectsASC->GetNumericAttribute(Attribute);
+				const float SnapshotValue = SnapshotASC->GetNumericAttribute(Attribute);
+				if (!FMath::IsNearlyEqual(EffectsBase, SnapshotBase) || !FMath::IsNearlyEqual(EffectsValue, SnapshotValue))
+				{
+					AddError(FString::Printf(TEXT("Class %d level %d %s: effects give %f (base %f), snapshot gives %f (base %f)"),
+					                         static_cast<int32>(CharacterClass), Level, *Attribute.GetName(), EffectsValue,
+					                         EffectsBase, SnapshotValue, SnapshotBase));
+				}
+			}
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraAttributeSnapshotSpawnTest, "Aura.Attributes.SpawnThousandEnemies",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraAttributeSnapshotSpawnTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraAttributeSnapshotTest;
+
+	constexpr int32 NumEnemies = 1000;
+
+	IConsoleVariable* VerifySnapshots = IConsoleManager::Get().FindConsoleVariable(TEXT("Aura.Attributes.VerifySnapshots"));
+	if (!TestNotNull(TEXT("Aura.Attributes.VerifySnapshots"), VerifySnapshots)) return false;
+	const bool bPreviousVerify = VerifySnapshots->GetBool();
+
+	// Verifying makes every spawn apply the default attribute effects, which is the cost the snapshots remove
+	double Seconds[2] = {0.0, 0.0};
+	for (const bool bEffects : {true, false})
+	{
+		FAuraTestWorld TestWorld(GameModeClassPath);
+		VerifySnapshots->Set(bEffects, ECVF_SetByCode);
+		SpawnEnemy(TestWorld.World, ECharacterClass::Warrior, 1);
+
+		{
+			FSimpleScopeSecondsCounter Counter(Seconds[bEffects ? 0 : 1]);
+			for (int32 i = 0; i < NumEnemies; ++i)
+			{
+				SpawnEnemy(TestWorld.World, ECharacterClass::Warrior, 1);
+			}
+		}
+	}
+	VerifySnapshots->Set(bPreviousVerify, ECVF_SetByCode);
+
+	UE_LOG(LogAura, Display, TEXT("Spawned %d enemies: %.1f ms with the default attribute effects, %.1f ms from the snapshot"),
+	       NumEnemies, Seconds[0] * 1000.0, Seconds[1] * 1000.0);
+	AddInfo(FString::Printf(TEXT("Effects %.1f ms, snapshot %.1f ms"), Seconds[0] * 1000.0, Seconds[1] * 1000.0));
+	return true;
+}
+
+#endif
@@ -0,0 +1,177 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Character/AuraEnemy.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Game/AuraCorpseSubsystem.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraCorpseTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+	/** Has the physics asset the ragdolls simulate with */
+	static const TCHAR* EnemyClassPath = TEXT("/Game/Blueprints/Character/Goblin_Spear/BP_Goblin_Spear.BP_Goblin_Spear_C");
+
+	constexpr int32 NumEnemies = 200;
+	constexpr int32 DeathsPerWave = 20;
+	constexpr int32 FramesBetweenWaves = 15;
+	constexpr int32 NumFrames = 300;
+
+	static AAuraEnemy* SpawnEnemy(FAuraTestWorld& TestWorld, UClass* EnemyClass, const FVector& Location)
+	{
+		const FTransform Transform(Location);
+		AAuraEnemy* Enemy = TestWorld.World->SpawnActorDeferred<AAuraEnemy>(
+			EnemyClass, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+		Enemy->FinishSpawning(Transform);
+		return Enemy;
+	}
+
+	/** Ground for the ragdolls to land on, its top at z = 0 */
+	static void SpawnFloor(FAuraTestWorld& TestWorld)
+	{
+		AStaticMeshActor* Floor = TestWorld.Spawn<AStaticMeshActor>(
+			AStaticMeshActor::StaticClass(), FTransform(FRotator::ZeroRotator, FVector(0.f, 0.f, -50.f), FVector(200.f, 200.f, 1.f)));
+		// A static mesh can't be swapped on a static component once the world has begun play
+		Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Floor->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+	}
+
+	/** The budgets are config values, set them the way DefaultGame.ini would */
+	static void SetIntConfig(UAuraCorpseSubsystem* Corpses, const TCHAR* PropertyName, int32 Value)
+	{
+		FIntProperty* Property = FindFProperty<FIntProperty>(UAuraCorpseSubsystem::StaticClass(), PropertyName);
+		Property->SetPropertyValue_InContainer(Corpses, Value);
+	}
+
+	static bool IsSimulating(const AAuraEnemy* Enemy)
+	{
+		return IsValid(Enemy) && Enemy->GetMesh()->IsSimulatingPhysics();
+	}
+
+	/** Frame times of NumEnemies ragdolls dying in waves, with at most RagdollBudget of them simulating at once */
+	struct FStressRun
+	{
+		double Seconds = 0.0;
+		double WorstFrameSeconds = 0.0;
+		int32 MaxSimulating = 0;
+	};
+
+	static FStressRun RunStress(UClass* EnemyClass, int32 RagdollBudget, int32 CorpseBudget)
+	{
+		FStressRun Run;
+		FAuraTestWorld TestWorld(GameModeClassPath);
+		SpawnFloor(TestWorld);
+		TestWorld.SpawnLocalPlayer(FVector(0.f, 0.f, 100.f));
+		UAuraCorpseSubsystem* Corpses = TestWorld.World->GetSubsystem<UAuraCorpseSubsystem>();
+		SetIntConfig(Corpses, TEXT("MaxSimultaneousRagdolls"), RagdollBudget);
+		SetIntConfig(Corpses, TEXT("MaxCorpses"), CorpseBudget);
+
+		TArray<TWeakObjectPtr<AAuraEnemy>> Enemies;
+		for (int32 i = 0; i < NumEnemies; ++i)
+		{
+			const FVector Location((i % 20 - 10) * 150.f, (i / 20 - 5) * 150.f, 100.f);
+			Enemies.Add(SpawnEnemy(TestWorld, EnemyClass, Location));
+		}
+
+		int32 NumDead = 0;
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			double FrameSeconds = 0.0;
+			{
+				FSimpleScopeSecondsCounter Counter(FrameSeconds);
+				if (Frame % FramesBetweenWaves == 0)
+				{
+					for (const int32 WaveEnd = FMath::Min(NumDead + DeathsPerWave, NumEnemies); NumDead < WaveEnd; ++NumDead)
+					{
+						if (AAuraEnemy* Enemy = Enemies[NumDead].Get())
+						{
+							Enemy->Die(FVector(0.f, 0.f, 500.f));
+						}
+					}
+				}
+				TestWorld.Tick();
+			}
+			Run.Seconds += FrameSeconds;
+			Run.WorstFrameSeconds = FMath::Max(Run.WorstFrameSeconds, FrameSeconds);
+
+			int32 NumSimulating = 0;
+			for (const TWeakObjectPtr<AAuraEnemy>& Enemy : Enemies)
+			{
+				NumSimulating += IsSimulating(Enemy.Get()) ? 1 : 0;
+			}
+			Run.MaxSimulating = FMath::Max(Run.MaxSimulating, NumSimulating);
+		}
+		return Run;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraCorpseFreezeTest, "Aura.Corpses.FreezeFarthestFromEveryPlayer",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraCorpseFreezeTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraCorpseTest;
+
+	UClass* EnemyClass = LoadClass<AAuraEnemy>(nullptr, EnemyClassPath);
+	if (!TestNotNull(TEXT("Enemy class"), EnemyClass)) return false;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+	TestWorld.SpawnLocalPlayer(FVector(-5000.f, 0.f, 100.f));
+	TestWorld.SpawnLocalPlayer(FVector(5000.f, 0.f, 100.f));
+	UAuraCorpseSubsystem* Corpses = TestWorld.World->GetSubsystem<UAuraCorpseSubsystem>();
+	if (!TestNotNull(TEXT("Corpse subsystem"), Corpses)) return false;
+	SetIntConfig(Corpses, TEXT("MaxSimultaneousRagdolls"), 2);
+
+	// Killed in this order, so neither the oldest ragdoll nor the one farthest from the first player is the middle one
+	AAuraEnemy* NearFirst = SpawnEnemy(TestWorld, EnemyClass, FVector(-4800.f, 0.f, 100.f));
+	AAuraEnemy* NearSecond = SpawnEnemy(TestWorld, EnemyClass, FVector(4800.f, 0.f, 100.f));
+	AAuraEnemy* Middle = SpawnEnemy(TestWorld, EnemyClass, FVector(0.f, 0.f, 100.f));
+	for (AAuraEnemy* Enemy : {NearFirst, NearSecond, Middle})
+	{
+		Enemy->Die(FVector::ZeroVector);
+	}
+
+	TestTrue(TEXT("Ragdoll next to the first player keeps simulating"), IsSimulating(NearFirst));
+	TestTrue(TEXT("Ragdoll next to the second player keeps simulating"), IsSimulating(NearSecond));
+	TestFalse(TEXT("Ragdoll far from both players is frozen"), IsSimulating(Middle));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraCorpsePhysicsBenchmark, "Aura.Corpses.RagdollPhysicsStress",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraCorpsePhysicsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraCorpseTest;
+
+	UClass* EnemyClass = LoadClass<AAuraEnemy>(nullptr, EnemyClassPath);
+	if (!TestNotNull(TEXT("Enemy class"), EnemyClass)) return false;
+
+	const UAuraCorpseSubsystem* Defaults = GetDefault<UAuraCorpseSubsystem>();
+	const int32 RagdollBudget = FindFProperty<FIntProperty>(UAuraCorpseSubsystem::StaticClass(),
+	                                                        TEXT("MaxSimultaneousRagdolls"))->GetPropertyValue_InContainer(Defaults);
+	const int32 CorpseBudget = FindFProperty<FIntProperty>(UAuraCorpseSubsystem::StaticClass(),
+	                                                       TEXT("MaxCorpses"))->GetPropertyValue_InContainer(Defaults);
+
+	// Every ragdoll simulating until it is gone, the way deaths were handled before the budget
+	const FStressRun Unbounded = RunStress(EnemyClass, NumEnemies, NumEnemies);
+	const FStressRun Budgeted = RunStress(EnemyClass, RagdollBudget, CorpseBudget);
+	TestTrue(TEXT("Simulating ragdolls stay within the budget"), Budgeted.MaxSimulating <= RagdollBudget);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d enemies dying %d at a time over %d frames. Unbounded: %.2f ms per frame, %.2f ms worst, ")
+		TEXT("%d simulating at most. Budget of %d ragdolls and %d corpses: %.2f ms per frame, %.2f ms worst, %d simulating at most"),
+		NumEnemies, DeathsPerWave, NumFrames, Unbounded.Seconds * 1000.0 / NumFrames, Unbounded.WorstFrameSeconds * 1000.0,
+		Unbounded.MaxSimulating, RagdollBudget, CorpseBudget, Budgeted.Seconds * 1000.0 / NumFrames,
+		Budgeted.WorstFrameSeconds * 1000.0, Budgeted.MaxSimulating));
+	return true;
+}
+
+#endif
@@ -0,0 +1,168 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "AuraAbilityTypes.h"
+#include "AuraGameplayTags.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "Character/AuraEnemy.h"
+#include "Game/AuraRandomSubsystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraDamageReplayTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+	static const TCHAR* DamageEffectClassPath = TEXT("/Game/Blueprints/AbilitySystem/Aura/Effects/GE_Damage.GE_Damage_C");
+
+	constexpr int32 NumHits = 200;
+	constexpr int32 Seed = 1337;
+	/** CRC-32 of "DamageReplaySource" as UTF-32, combined with Seed, worked out outside the engine */
+	constexpr int32 SourceStreamSeed = 392200855;
+
+	struct FRecordedHit
+	{
+		FGameplayTag DamageType;
+		float BaseDamage = 0.f;
+		float DebuffChance = 0.f;
+	};
+
+	struct FHitOutcome
+	{
+		bool bBlocked = false;
+		bool bCriticalHit = false;
+		bool bDebuff = false;
+
+		bool operator==(const FHitOutcome& Other) const
+		{
+			return bBlocked == Other.bBlocked && bCriticalHit == Other.bCriticalHit && bDebuff == Other.bDebuff;
+		}
+	};
+
+	static TArray<FRecordedHit> RecordHits()
+	{
+		TArray<FGameplayTag> DamageTypes;
+		FAuraGameplayTags::Get().DamageTypesToDebuffs.GetKeys(DamageTypes);
+
+		// A stream of the test's own, the subsystem's streams are what is under test
+		FRandomStream Stream(42);
+		TArray<FRecordedHit> Hits;
+		for (int32 i = 0; i < NumHits; ++i)
+		{
+			FRecordedHit& Hit = Hits.AddDefaulted_GetRef();
+			Hit.DamageType = DamageTypes[Stream.RandHelper(DamageTypes.Num())];
+			Hit.BaseDamage = Stream.FRandRange(5.f, 50.f);
+			Hit.DebuffChance = Stream.FRandRange(0.f, 100.f);
+		}
+		return Hits;
+	}
+
+	/** Stream seeds come from the source's name, so both runs spawn their enemies under the same names */
+	static AAuraEnemy* SpawnEnemy(UWorld* World, const TCHAR* Name)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = FName(Name);
+		SpawnParams.bDeferConstruction = true;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		AAuraEnemy* Enemy = World->SpawnActor<AAuraEnemy>(AAuraEnemy::StaticClass(), FTransform::Identity, SpawnParams);
+		Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+		Enemy->FinishSpawning(FTransform::Identity);
+		return Enemy;
+	}
+
+	/** Runs the hits through ExecCalc_Damage in a fresh world started with the current Aura.Random.Seed */
+	static TArray<FHitOutcome> PlayHits(const TArray<FRecordedHit>& Hits, TSubclassOf<UGameplayEffect> DamageEffectClass,
+	                                    int32& OutSourceStreamSeed)
+	{
+		FAuraTestWorld TestWorld(GameModeClassPath);
+		const AAuraEnemy* Source = SpawnEnemy(TestWorld.World, TEXT("DamageReplaySource"));
+		OutSourceStreamSeed = UAuraRandomSubsystem::GetStream(TestWorld.World, Source).GetInitialSeed();
+		const AAuraEnemy* Target = SpawnEnemy(TestWorld.World, TEXT("DamageReplayTarget"));
+		UAbilitySystemComponent* TargetASC = Target->GetAbilitySystemComponent();
+
+		TArray<FHitOutcome> Outcomes;
+		for (const FRecordedHit& Hit : Hits)
+		{
+			// Keep the target alive so every hit lands on the same attributes
+			TargetASC->SetNumericAttributeBase(UAuraAttributeSet::GetHealthAttribute(),
+			                                   TargetASC->GetNumericAttribute(UAuraAttributeSet::GetMaxHealthAttribute()));
+
+			FDamageEffectParams Params;
+			Params.WorldContextObject = TestWorld.World;
+			Params.DamageGameplayEffectClass = DamageEffectClass;
+			Params.SourceAbilitySystemComponent = Source->GetAbilitySystemComponent();
+			Params.TargetAbilitySystemComponent = TargetASC;
+			Params.BaseDamage = Hit.BaseDamage;
+			Params.DamageType = Hit.DamageType;
+			Params.DebuffChance = Hit.DebuffChance;
+			Params.DebuffDamage = 1.f;
+			Params.DebuffDuration = 1.f;
+			Params.DebuffFrequency = 1.f;
+			const FGameplayEffectContextHandle Context = UAuraAbilitySystemLibrary::ApplyDamageEffect(Params);
+
+			FHitOutcome& Outcome = Outcomes.AddDefaulted_GetRef();
+			Outcome.bBlocked = UAuraAbilitySystemLibrary::IsBlockedHit(Context);
+			Outcome.bCriticalHit = UAuraAbilitySystemLibrary::IsCriticalHit(Context);
+			Outcome.bDebuff = UAuraAbilitySystemLibrary::IsSuccessfulDebuff(Context);
+		}
+		return Outcomes;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraDamageReplayTest, "Aura.Random.DamageReplaysWithSeed",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraDamageReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraDamageReplayTest;
+
+	const TSubclassOf<UGameplayEffect> DamageEffectClass = LoadClass<UGameplayEffect>(nullptr, DamageEffectClassPath);
+	if (!TestNotNull(TEXT("Damage effect class"), DamageEffectClass.Get())) return false;
+
+	IConsoleVariable* SeedVariable = IConsoleManager::Get().FindConsoleVariable(TEXT("Aura.Random.Seed"));
+	if (!TestNotNull(TEXT("Aura.Random.Seed"), SeedVariable)) return false;
+	const int32 PreviousSeed = SeedVariable->GetInt();
+	SeedVariable->Set(Seed, ECVF_SetByCode);
+
+	const TArray<FRecordedHit> Hits = RecordHits();
+	int32 FirstStreamSeed = 0;
+	int32 SecondStreamSeed = 0;
+	const TArray<FHitOutcome> FirstRun = PlayHits(Hits, DamageEffectClass, FirstStreamSeed);
+	const TArray<FHitOutcome> SecondRun = PlayHits(Hits, DamageEffectClass, SecondStreamSeed);
+	SeedVariable->Set(PreviousSeed, ECVF_SetByCode);
+
+	// A fixed value rather than one run against the other, both runs share a process and its name table
+	TestEqual(TEXT("Seed derivation"), UAuraRandomSubsystem::MakeStreamSeed(Seed, TEXT("DamageReplaySource")),
+	          SourceStreamSeed);
+	TestEqual(TEXT("First run seeds the source stream from its name"), FirstStreamSeed, SourceStreamSeed);
+	TestEqual(TEXT("Second run seeds the source stream from its name"), SecondStreamSeed, SourceStreamSeed);
+
+	if (!TestEqual(TEXT("Both runs play every hit"), SecondRun.Num(), FirstRun.Num())) return false;
+
+	int32 NumBlocked = 0;
+	int32 NumCriticalHits = 0;
+	int32 NumDebuffs = 0;
+	for (int32 Index = 0; Index < FirstRun.Num(); ++Index)
+	{
+		if (!(FirstRun[Index] == SecondRun[Index]))
+		{
+			AddError(FString::Printf(TEXT("Hit %d replayed differently: blocked %d/%d, critical %d/%d, debuff %d/%d"),
+			                         Index, FirstRun[Index].bBlocked, SecondRun[Index].bBlocked,
+			                         FirstRun[Index].bCriticalHit, SecondRun[Index].bCriticalHit,
+			                         FirstRun[Index].bDebuff, SecondRun[Index].bDebuff));
+		}
+		NumBlocked += FirstRun[Index].bBlocked;
+		NumCriticalHits += FirstRun[Index].bCriticalHit;
+		NumDebuffs += FirstRun[Index].bDebuff;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d hits: %d blocked, %d critical, %d debuffs"), FirstRun.Num(), NumBlocked,
+	                        NumCriticalHits, NumDebuffs));
+	return true;
+}
+
+#endif
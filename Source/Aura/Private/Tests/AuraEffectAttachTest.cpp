@@ -0,0 +1,152 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_AURA_COSMETICS
+
+#include "AbilitySystemComponent.h"
+#include "AuraGameplayTags.h"
+#include "Character/AuraEnemy.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraEffectAttachTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+
+	constexpr int32 NumEnemies = 500;
+	constexpr int32 NumFrames = 120;
+	/** Degrees each enemy turns per frame */
+	constexpr float TurnRate = 7.f;
+
+	static AAuraEnemy* SpawnEnemy(FAuraTestWorld& TestWorld, const FVector& Location)
+	{
+		const FTransform Transform(Location);
+		AAuraEnemy* Enemy = TestWorld.World->SpawnActorDeferred<AAuraEnemy>(
+			AAuraEnemy::StaticClass(), Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+		Enemy->FinishSpawning(Transform);
+		return Enemy;
+	}
+
+	/** The attach point is private, read it the way the details panel does */
+	static USceneComponent* GetEffectAttachComponent(AAuraCharacterBase* Character)
+	{
+		const FObjectProperty* Property = FindFProperty<FObjectProperty>(AAuraCharacterBase::StaticClass(),
+		                                                                 TEXT("EffectAttachComponent"));
+		return Cast<USceneComponent>(Property->GetObjectPropertyValue_InContainer(Character));
+	}
+
+	static void Turn(const TArray<AAuraEnemy*>& Enemies)
+	{
+		for (AAuraEnemy* Enemy : Enemies)
+		{
+			Enemy->AddActorWorldRotation(FRotator(0.f, TurnRate, 0.f));
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectAttachAlignmentTest, "Aura.Characters.StatusEffectsStayWorldAligned",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraEffectAttachAlignmentTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraEffectAttachTest;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+	AAuraEnemy* Enemy = SpawnEnemy(TestWorld, FVector::ZeroVector);
+	USceneComponent* AttachPoint = GetEffectAttachComponent(Enemy);
+	if (!TestNotNull(TEXT("Effect attach point"), AttachPoint)) return false;
+
+	// Burn is one of the configured status effects, its system is spawned onto the attach point
+	Enemy->GetAbilitySystemComponent()->AddLooseGameplayTag(FAuraGameplayTags::Get().Debuff_Burn);
+	TestTrue(TEXT("Burn effect is attached to the attach point"), AttachPoint->GetNumChildrenComponents() > 0);
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		Turn({Enemy});
+		TestWorld.Tick();
+
+		if (!AttachPoint->GetComponentQuat().Equals(FQuat::Identity, UE_KINDA_SMALL_NUMBER))
+		{
+			AddError(FString::Printf(TEXT("Attach point turned to %s at yaw %.1f"),
+			                         *AttachPoint->GetComponentRotation().ToString(), Enemy->GetActorRotation().Yaw));
+			break;
+		}
+		for (const USceneComponent* Effect : AttachPoint->GetAttachChildren())
+		{
+			if (Effect && !Effect->GetComponentQuat().Equals(FQuat::Identity, UE_KINDA_SMALL_NUMBER))
+			{
+				AddError(FString::Printf(TEXT("%s turned to %s"), *Effect->GetName(),
+				                         *Effect->GetComponentRotation().ToString()));
+			}
+		}
+		// The attach point still follows the character around
+		if (!AttachPoint->GetComponentLocation().Equals(Enemy->GetActorLocation(), 1.f))
+		{
+			AddError(TEXT("Attach point no longer follows the character"));
+			break;
+		}
+	}
+
+	Enemy->GetAbilitySystemComponent()->RemoveLooseGameplayTag(FAuraGameplayTags::Get().Debuff_Burn);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectAttachBenchmark, "Aura.Characters.FiveHundredEnemiesTurning",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraEffectAttachBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraEffectAttachTest;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+	TArray<AAuraEnemy*> Enemies;
+	TArray<USceneComponent*> AttachPoints;
+	for (int32 i = 0; i < NumEnemies; ++i)
+	{
+		AAuraEnemy* Enemy = SpawnEnemy(TestWorld, FVector((i % 25) * 200.f, (i / 25) * 200.f, 0.f));
+		Enemies.Add(Enemy);
+		AttachPoints.Add(GetEffectAttachComponent(Enemy));
+	}
+
+	int32 NumTicking = 0;
+	for (const AAuraEnemy* Enemy : Enemies)
+	{
+		NumTicking += Enemy->IsActorTickEnabled() ? 1 : 0;
+	}
+	TestEqual(TEXT("Enemies don't tick to keep their effects aligned"), NumTicking, 0);
+
+	// Absolute rotation: turning the enemies leaves the attach points alone
+	double AbsoluteSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		FSimpleScopeSecondsCounter Counter(AbsoluteSeconds);
+		Turn(Enemies);
+		TestWorld.Tick();
+	}
+
+	// What every character's Tick did before: a relative attach point set back to world zero each frame
+	for (USceneComponent* AttachPoint : AttachPoints)
+	{
+		AttachPoint->SetUsingAbsoluteRotation(false);
+	}
+	double ResetSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		FSimpleScopeSecondsCounter Counter(ResetSeconds);
+		Turn(Enemies);
+		TestWorld.Tick();
+		for (USceneComponent* AttachPoint : AttachPoints)
+		{
+			AttachPoint->SetWorldRotation(FRotator::ZeroRotator);
+		}
+	}
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d enemies turning over %d frames: %.2f ms per frame with absolute rotation, ")
+		TEXT("%.2f ms per frame resetting the attach point every frame"),
+		NumEnemies, NumFrames, AbsoluteSeconds * 1000.0 / NumFrames, ResetSeconds * 1000.0 / NumFrames));
+	return true;
+}
+
+#endif
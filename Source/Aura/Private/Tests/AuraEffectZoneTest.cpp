@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Actor/AuraEffectActor.h"
+#include "GameFramework/Pawn.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraEffectZoneTest
+{
+	/** Infinite and periodic on Health, the same setup a healing zone has */
+	static const TCHAR* ZoneEffectClassPath = TEXT("/Game/Blueprints/Actor/Area/GE_FireArea.GE_FireArea_C");
+
+	constexpr int32 NumPlayers = 100;
+	constexpr int32 NumFrames = 120;
+	/** Players walking out and back in on every frame while the zone is full */
+	constexpr int32 PlayersChurnedPerFrame = 10;
+
+	/** The zone's effect settings are protected, set them the way the Blueprint defaults would */
+	static void SetupZone(AAuraEffectActor* Zone, UClass* EffectClass)
+	{
+		FClassProperty* EffectProperty = FindFProperty<FClassProperty>(AAuraEffectActor::StaticClass(),
+		                                                               TEXT("InfiniteGameplayEffectClass"));
+		EffectProperty->SetObjectPropertyValue_InContainer(Zone, EffectClass);
+
+		FEnumProperty* PolicyProperty = FindFProperty<FEnumProperty>(AAuraEffectActor::StaticClass(),
+		                                                             TEXT("InfiniteEffectApplicationPolicy"));
+		PolicyProperty->GetUnderlyingProperty()->SetIntPropertyValue(
+			PolicyProperty->ContainerPtrToValuePtr<void>(Zone),
+			static_cast<int64>(EEffectApplicationPolicy::ApplyOnOverlap));
+	}
+
+	/** Overlap events are bound in the Blueprint, call them the same way */
+	static void CallOverlapEvent(AAuraEffectActor* Zone, const TCHAR* FunctionName, AActor* Player)
+	{
+		struct
+		{
+			AActor* TargetActor;
+		} Params{Player};
+		Zone->ProcessEvent(Zone->FindFunctionChecked(FunctionName), &Params);
+	}
+
+	static int32 CountActiveEffects(const TArray<UAbilitySystemComponent*>& ASCs)
+	{
+		int32 NumActive = 0;
+		for (const UAbilitySystemComponent* ASC : ASCs)
+		{
+			NumActive += ASC->GetActiveEffects(FGameplayEffectQuery()).Num();
+		}
+		return NumActive;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectZoneBenchmark, "Aura.Effects.HundredPlayersInZone",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraEffectZoneBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraEffectZoneTest;
+
+	UClass* EffectClass = LoadClass<UGameplayEffect>(nullptr, ZoneEffectClassPath);
+	if (!TestNotNull(TEXT("Zone effect class"), EffectClass)) return false;
+	if (!TestEqual(TEXT("Zone effect is infinite"), GetDefault<UGameplayEffect>(EffectClass)->DurationPolicy,
+	               EGameplayEffectDurationType::Infinite))
+	{
+		return false;
+	}
+
+	FAuraTestWorld TestWorld;
+	AAuraEffectActor* Zone = TestWorld.Spawn<AAuraEffectActor>();
+	SetupZone(Zone, EffectClass);
+
+	TArray<APawn*> Players;
+	TArray<UAbilitySystemComponent*> ASCs;
+	for (int32 i = 0; i < NumPlayers; ++i)
+	{
+		APawn* Player = TestWorld.Spawn<APawn>(APawn::StaticClass(), FTransform(FVector((i % 10) * 100.f, (i / 10) * 100.f, 0.f)));
+		UAbilitySystemComponent* ASC = NewObject<UAbilitySystemComponent>(Player);
+		ASC->RegisterComponent();
+		ASC->InitAbilityActorInfo(Player, Player);
+		Players.Add(Player);
+		ASCs.Add(ASC);
+	}
+
+	double EnterSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(EnterSeconds);
+		for (APawn* Player : Players)
+		{
+			CallOverlapEvent(Zone, TEXT("OnOverlap"), Player);
+		}
+	}
+	TestEqual(TEXT("Every player in the zone has its effect"), CountActiveEffects(ASCs), NumPlayers);
+
+	// The zone stays full while players keep stepping out and back in
+	double ChurnSeconds = 0.0;
+	double WorstChurnFrameSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		double FrameSeconds = 0.0;
+		{
+			FSimpleScopeSecondsCounter Counter(FrameSeconds);
+			for (int32 i = 0; i < PlayersChurnedPerFrame; ++i)
+			{
+				APawn* Player = Players[(Frame * PlayersChurnedPerFrame + i) % NumPlayers];
+				CallOverlapEvent(Zone, TEXT("OnEndOverlap"), Player);
+				CallOverlapEvent(Zone, TEXT("OnOverlap"), Player);
+			}
+			TestWorld.Tick();
+		}
+		ChurnSeconds += FrameSeconds;
+		WorstChurnFrameSeconds = FMath::Max(WorstChurnFrameSeconds, FrameSeconds);
+	}
+	TestEqual(TEXT("Stepping out and back in leaves one effect per player"), CountActiveEffects(ASCs), NumPlayers);
+
+	double LeaveSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(LeaveSeconds);
+		for (APawn* Player : Players)
+		{
+			CallOverlapEvent(Zone, TEXT("OnEndOverlap"), Player);
+		}
+	}
+	TestEqual(TEXT("Leaving the zone removes every effect"), CountActiveEffects(ASCs), 0);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d players: %.3f ms entering the zone, %.3f ms leaving it, ")
+		TEXT("%.3f ms per frame (%.3f ms worst) with %d stepping out and back in every frame"),
+		NumPlayers, EnterSeconds * 1000.0, LeaveSeconds * 1000.0, ChurnSeconds * 1000.0 / NumFrames,
+		WorstChurnFrameSeconds * 1000.0, PlayersChurnedPerFrame));
+	return true;
+}
+
+#endif
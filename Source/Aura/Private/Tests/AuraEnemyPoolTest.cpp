@@ -0,0 +1,133 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Character/AuraEnemy.h"
+#include "Game/AuraEnemyPoolSubsystem.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraEnemyPoolTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+	static const TCHAR* EnemyClassPath = TEXT("/Game/Blueprints/Character/Goblin_Spear/BP_Goblin_Spear.BP_Goblin_Spear_C");
+
+	/** The default MaxPooledPerClass, so every wave after the first fits in the pool */
+	constexpr int32 EnemiesPerWave = 16;
+	constexpr int32 NumWaves = 10;
+	/** Frames the dead enemies lie around before their corpses are removed */
+	constexpr int32 FramesBetweenWaves = 30;
+
+	static FTransform GetSpawnTransform(int32 Index)
+	{
+		return FTransform(FVector((Index % 4) * 200.f, (Index / 4) * 200.f, 100.f));
+	}
+
+	/** Spawn frame of each wave: the enemies come in and the world ticks once */
+	struct FWaveRun
+	{
+		double FirstWaveSeconds = 0.0;
+		double LaterWavesSeconds = 0.0;
+		double WorstLaterWaveSeconds = 0.0;
+		int32 NumReused = 0;
+	};
+
+	/** Kills the wave, lets the corpses lie, then removes them the way their life span would */
+	static void EndWave(FAuraTestWorld& TestWorld, const TArray<AAuraEnemy*>& Wave)
+	{
+		for (AAuraEnemy* Enemy : Wave)
+		{
+			Enemy->Die(FVector::ZeroVector);
+		}
+		TestWorld.TickFrames(FramesBetweenWaves);
+		for (AAuraEnemy* Enemy : Wave)
+		{
+			if (IsValid(Enemy))
+			{
+				Enemy->RemoveCorpse();
+			}
+		}
+	}
+
+	static FWaveRun RunWaves(UClass* EnemyClass, bool bPooled)
+	{
+		FWaveRun Run;
+		FAuraTestWorld TestWorld(GameModeClassPath);
+		UAuraEnemyPoolSubsystem* EnemyPool = TestWorld.World->GetSubsystem<UAuraEnemyPoolSubsystem>();
+
+		TSet<AAuraEnemy*> SeenEnemies;
+		for (int32 WaveIndex = 0; WaveIndex < NumWaves; ++WaveIndex)
+		{
+			TArray<AAuraEnemy*> Wave;
+			double WaveSeconds = 0.0;
+			{
+				FSimpleScopeSecondsCounter Counter(WaveSeconds);
+				for (int32 i = 0; i < EnemiesPerWave; ++i)
+				{
+					if (bPooled)
+					{
+						Wave.Add(EnemyPool->AcquireEnemy(EnemyClass, GetSpawnTransform(i), 1, ECharacterClass::Warrior));
+						continue;
+					}
+					// What spawn points did before the pool: a new enemy and controller every time
+					AAuraEnemy* Enemy = TestWorld.World->SpawnActorDeferred<AAuraEnemy>(
+						EnemyClass, GetSpawnTransform(i), nullptr, nullptr,
+						ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+					Enemy->SetLevel(1);
+					Enemy->SetCharacterClass(ECharacterClass::Warrior);
+					Enemy->FinishSpawning(GetSpawnTransform(i));
+					Enemy->SpawnDefaultController();
+					Wave.Add(Enemy);
+				}
+				TestWorld.Tick();
+			}
+
+			if (WaveIndex == 0)
+			{
+				Run.FirstWaveSeconds = WaveSeconds;
+			}
+			else
+			{
+				Run.LaterWavesSeconds += WaveSeconds;
+				Run.WorstLaterWaveSeconds = FMath::Max(Run.WorstLaterWaveSeconds, WaveSeconds);
+			}
+			for (AAuraEnemy* Enemy : Wave)
+			{
+				bool bAlreadySeen = false;
+				SeenEnemies.Add(Enemy, &bAlreadySeen);
+				Run.NumReused += bAlreadySeen ? 1 : 0;
+			}
+			EndWave(TestWorld, Wave);
+		}
+		return Run;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEnemyPoolBenchmark, "Aura.Enemies.PooledWaveHitch",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraEnemyPoolBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraEnemyPoolTest;
+
+	UClass* EnemyClass = LoadClass<AAuraEnemy>(nullptr, EnemyClassPath);
+	if (!TestNotNull(TEXT("Enemy class"), EnemyClass)) return false;
+
+	const FWaveRun Spawned = RunWaves(EnemyClass, false);
+	const FWaveRun Pooled = RunWaves(EnemyClass, true);
+	TestEqual(TEXT("Every wave after the first comes from the pool"), Pooled.NumReused,
+	          (NumWaves - 1) * EnemiesPerWave);
+
+	constexpr int32 NumLaterWaves = NumWaves - 1;
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d waves of %d enemies, wave frame: spawning %.2f ms first, %.2f ms after (%.2f ms worst), ")
+		TEXT("pooled %.2f ms first, %.2f ms after (%.2f ms worst)"),
+		NumWaves, EnemiesPerWave, Spawned.FirstWaveSeconds * 1000.0,
+		Spawned.LaterWavesSeconds * 1000.0 / NumLaterWaves, Spawned.WorstLaterWaveSeconds * 1000.0,
+		Pooled.FirstWaveSeconds * 1000.0, Pooled.LaterWavesSeconds * 1000.0 / NumLaterWaves,
+		Pooled.WorstLaterWaveSeconds * 1000.0));
+	return true;
+}
+
+#endif
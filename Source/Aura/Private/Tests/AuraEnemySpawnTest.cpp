@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NiagaraComponent.h"
+#include "Character/AuraEnemy.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraEnemySpawnTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+	/** Saved with the burn and stun components characters used to create for every enemy */
+	static const TCHAR* EnemyClassPath = TEXT("/Game/Blueprints/Character/Goblin_Spear/BP_Goblin_Spear.BP_Goblin_Spear_C");
+
+	constexpr int32 NumEnemies = 500;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEnemySpawnTest, "Aura.Characters.FiveHundredEnemiesSpawn",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraEnemySpawnTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraEnemySpawnTest;
+
+	UClass* EnemyClass = LoadClass<AAuraEnemy>(nullptr, EnemyClassPath);
+	if (!TestNotNull(TEXT("Enemy class"), EnemyClass)) return false;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+
+	TArray<AAuraEnemy*> Enemies;
+	Enemies.Reserve(NumEnemies);
+	double SpawnSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(SpawnSeconds);
+		for (int32 i = 0; i < NumEnemies; ++i)
+		{
+			const FTransform Transform(FVector((i % 25) * 200.f, (i / 25) * 200.f, 0.f));
+			AAuraEnemy* Enemy = TestWorld.World->SpawnActorDeferred<AAuraEnemy>(
+				EnemyClass, Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+			Enemy->FinishSpawning(Transform);
+			Enemies.Add(Enemy);
+		}
+	}
+
+	int32 NumComponents = 0;
+	int32 NumNiagaraComponents = 0;
+	SIZE_T ComponentBytes = 0;
+	for (const AAuraEnemy* Enemy : Enemies)
+	{
+		for (UActorComponent* Component : Enemy->GetComponents())
+		{
+			++NumComponents;
+			NumNiagaraComponents += Component->IsA<UNiagaraComponent>() ? 1 : 0;
+			ComponentBytes += Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+		}
+	}
+	// Status effects come from the Niagara pool once they start, nothing is created for them up front
+	TestEqual(TEXT("Enemies spawn without Niagara components"), NumNiagaraComponents, 0);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d enemies: %.2f ms to spawn (%.1f us each), %.1f components and %.1f KB of components per enemy"),
+		NumEnemies, SpawnSeconds * 1000.0, SpawnSeconds * 1000000.0 / NumEnemies,
+		static_cast<double>(NumComponents) / NumEnemies, ComponentBytes / 1024.0 / NumEnemies));
+	return true;
+}
+
+#endif
@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AuraGameplayTags.h"
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Player/AuraControllerCoreComponent.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraInputBlockTest, "Aura.Input.StunBlocksInput",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraInputBlockTest::RunTest(const FString& Parameters)
+{
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	const EAuraInputBlock StunBlocks = EAuraInputBlock::InputPressed | EAuraInputBlock::InputHeld |
+		EAuraInputBlock::InputReleased | EAuraInputBlock::CursorTrace;
+
+	// The same tags AAuraCharacter::OnRep_Stunned adds and removes
+	FGameplayTagContainer StunTags;
+	StunTags.AddTag(GameplayTags.Player_Block_CursorTrace);
+	StunTags.AddTag(GameplayTags.Player_Block_InputHeld);
+	StunTags.AddTag(GameplayTags.Player_Block_InputPressed);
+	StunTags.AddTag(GameplayTags.Player_Block_InputReleased);
+
+	FAuraTestWorld TestWorld;
+	APawn* Pawn = TestWorld.Spawn<APawn>();
+	UAuraAbilitySystemComponent* ASC = NewObject<UAuraAbilitySystemComponent>(Pawn);
+	ASC->RegisterComponent();
+	ASC->InitAbilityActorInfo(Pawn, Pawn);
+
+	APlayerController* PlayerController = TestWorld.Spawn<APlayerController>();
+	PlayerController->Possess(Pawn);
+
+	UAuraControllerCoreComponent* ControllerCore = NewObject<UAuraControllerCoreComponent>(PlayerController);
+	ControllerCore->RegisterComponent();
+	ControllerCore->PreProcessInput();
+	if (!TestEqual(TEXT("Controller core resolves the pawn's ASC"), ControllerCore->GetASC(), ASC)) return false;
+	TestFalse(TEXT("Nothing is blocked before the stun"), ControllerCore->IsBlocked(StunBlocks));
+
+	for (int32 Cycle = 0; Cycle < 2; ++Cycle)
+	{
+		ASC->AddLooseGameplayTags(StunTags);
+		for (const EAuraInputBlock Block : {EAuraInputBlock::InputPressed, EAuraInputBlock::InputHeld,
+		                                    EAuraInputBlock::InputReleased, EAuraInputBlock::CursorTrace})
+		{
+			TestTrue(FString::Printf(TEXT("Stun blocks input %d"), static_cast<int32>(Block)), ControllerCore->IsBlocked(Block));
+		}
+
+		ASC->RemoveLooseGameplayTags(StunTags);
+		TestFalse(TEXT("Stun ending unblocks every input"), ControllerCore->IsBlocked(StunBlocks));
+	}
+
+	// A tag held twice keeps blocking until both are removed
+	ASC->AddLooseGameplayTag(GameplayTags.Player_Block_InputPressed);
+	ASC->AddLooseGameplayTag(GameplayTags.Player_Block_InputPressed);
+	ASC->RemoveLooseGameplayTag(GameplayTags.Player_Block_InputPressed);
+	TestTrue(TEXT("Block stays while a tag count remains"), ControllerCore->IsBlocked(EAuraInputBlock::InputPressed));
+	ASC->RemoveLooseGameplayTag(GameplayTags.Player_Block_InputPressed);
+	TestFalse(TEXT("Block clears with the last tag count"), ControllerCore->IsBlocked(EAuraInputBlock::InputPressed));
+
+	// A controller core that binds while the pawn is already stunned starts out blocked
+	ASC->AddLooseGameplayTags(StunTags);
+	UAuraControllerCoreComponent* LateControllerCore = NewObject<UAuraControllerCoreComponent>(PlayerController);
+	LateControllerCore->RegisterComponent();
+	LateControllerCore->PreProcessInput();
+	TestTrue(TEXT("Binding seeds the block bits from the current tags"), LateControllerCore->IsBlocked(EAuraInputBlock::CursorTrace));
+	ASC->RemoveLooseGameplayTags(StunTags);
+	TestFalse(TEXT("Late binding still follows the stun ending"), LateControllerCore->IsBlocked(StunBlocks));
+
+	return true;
+}
+
+#endif
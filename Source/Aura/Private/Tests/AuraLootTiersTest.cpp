@@ -0,0 +1,190 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/Data/LootTiers.h"
+#include "Aura/AuraLogChannels.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "UObject/Package.h"
+
+namespace AuraLootTiersTest
+{
+	/** Chance of exactly Count copies out of MaxCount, each dropping with CopyChance */
+	static double BinomialChance(int32 MaxCount, double CopyChance, int32 Count)
+	{
+		double Chance = 1.0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Chance *= static_cast<double>(MaxCount - i) / (i + 1);
+		}
+		return Chance * FMath::Pow(CopyChance, Count) * FMath::Pow(1.0 - CopyChance, MaxCount - Count);
+	}
+
+	/** Wilson-Hilferty approximation of the chi-squared value a correct sampler exceeds once in a thousand runs */
+	static double CriticalChiSquared(int32 DegreesOfFreedom)
+	{
+		constexpr double Z = 3.09;
+		const double Term = 2.0 / (9.0 * DegreesOfFreedom);
+		return DegreesOfFreedom * FMath::Pow(1.0 - Term + Z * FMath::Sqrt(Term), 3.0);
+	}
+
+	/** The roll GetLootItems made before the alias tables, one FRandRange per copy */
+	static void RollLootPerCopy(const TArray<FLootItem>& LootItems, FRandomStream& Stream, TArray<FLootItem>& OutItems)
+	{
+		OutItems.Reset();
+		for (const FLootItem& Item : LootItems)
+		{
+			for (int32 i = 0; i < Item.MaxNumberToSpawn; ++i)
+			{
+				if (Stream.FRandRange(1.f, 100.f) < Item.ChanceToSpawn)
+				{
+					FLootItem& NewItem = OutItems.AddDefaulted_GetRef();
+					NewItem.LootClass = Item.LootClass;
+					NewItem.bLootLevelOverride = Item.bLootLevelOverride;
+				}
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraLootCountTableTest, "Aura.Loot.CountTableMatchesBinomial",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraLootCountTableTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraLootTiersTest;
+
+	constexpr int32 NumSamples = 200000;
+
+	struct FCase
+	{
+		int32 MaxCount;
+		double CopyChance;
+	};
+	const FCase Cases[] = {{1, 0.5}, {2, 0.1}, {3, 0.25}, {5, 0.7}, {8, 0.5}, {10, 0.05}, {16, 0.33}};
+
+	for (const FCase& Case : Cases)
+	{
+		FLootCountTable Table;
+		Table.Build(Case.MaxCount, Case.CopyChance);
+		TestEqual(TEXT("One column per copy count"), Table.Probability.Num(), Case.MaxCount + 1);
+
+		TArray<int32> Observed;
+		Observed.SetNumZeroed(Case.MaxCount + 1);
+		FRandomStream Stream(Case.MaxCount * 7919 + 17);
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const int32 Count = Table.Sample(Stream);
+			if (!TestTrue(TEXT("Sample is a valid copy count"), Count >= 0 && Count <= Case.MaxCount)) return false;
+			++Observed[Count];
+		}
+
+		// Counts expected fewer than five times are pooled into one bin, the chi-squared approximation needs that
+		double ChiSquared = 0.0;
+		int32 NumBins = 0;
+		double PooledExpected = 0.0;
+		int32 PooledObserved = 0;
+		for (int32 Count = 0; Count <= Case.MaxCount; ++Count)
+		{
+			const double Expected = BinomialChance(Case.MaxCount, Case.CopyChance, Count) * NumSamples;
+			if (Expected < 5.0)
+			{
+				PooledExpected += Expected;
+				PooledObserved += Observed[Count];
+				continue;
+			}
+			ChiSquared += FMath::Square(Observed[Count] - Expected) / Expected;
+			++NumBins;
+		}
+		if (PooledExpected > 0.0)
+		{
+			ChiSquared += FMath::Square(PooledObserved - PooledExpected) / PooledExpected;
+			++NumBins;
+		}
+
+		const double Critical = CriticalChiSquared(FMath::Max(NumBins - 1, 1));
+		if (ChiSquared > Critical)
+		{
+			AddError(FString::Printf(TEXT("%d copies at %.2f: chi-squared %.2f over %d bins exceeds %.2f"),
+			                         Case.MaxCount, Case.CopyChance, ChiSquared, NumBins, Critical));
+		}
+	}
+
+	// Degenerate tables always give the same count
+	FRandomStream Stream(1);
+	FLootCountTable Never;
+	Never.Build(4, 0.0);
+	FLootCountTable Always;
+	Always.Build(4, 1.0);
+	FLootCountTable Empty;
+	Empty.Build(0, 0.5);
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		if (Never.Sample(Stream) != 0 || Always.Sample(Stream) != 4 || Empty.Sample(Stream) != 0)
+		{
+			AddError(TEXT("Degenerate table returned an impossible count"));
+			break;
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraLootRollBenchmark, "Aura.Loot.MillionRolls",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraLootRollBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraLootTiersTest;
+
+	constexpr int32 NumRolls = 1000000;
+
+	ULootTiers* LootTiers = NewObject<ULootTiers>(GetTransientPackage());
+	const float Chances[] = {75.f, 40.f, 20.f, 10.f, 5.f};
+	const int32 MaxCounts[] = {5, 4, 3, 2, 1};
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Chances); ++Index)
+	{
+		FLootItem& Item = LootTiers->LootItems.AddDefaulted_GetRef();
+		Item.LootClass = AActor::StaticClass();
+		Item.ChanceToSpawn = Chances[Index];
+		Item.MaxNumberToSpawn = MaxCounts[Index];
+	}
+
+	TArray<FLootItem> Items;
+	int64 NumItems[2] = {0, 0};
+	double Seconds[2] = {0.0, 0.0};
+	{
+		FRandomStream Stream(42);
+		FSimpleScopeSecondsCounter Counter(Seconds[0]);
+		for (int32 i = 0; i < NumRolls; ++i)
+		{
+			RollLootPerCopy(LootTiers->LootItems, Stream, Items);
+			NumItems[0] += Items.Num();
+		}
+	}
+	{
+		FRandomStream Stream(42);
+		// The first roll builds the count tables, keep that out of the timing
+		LootTiers->RollLoot(Stream, Items);
+		FSimpleScopeSecondsCounter Counter(Seconds[1]);
+		for (int32 i = 0; i < NumRolls; ++i)
+		{
+			LootTiers->RollLoot(Stream, Items);
+			NumItems[1] += Items.Num();
+		}
+	}
+
+	// Both follow the same distribution, so the average drop count agrees to well within a percent
+	const double PerCopyAverage = static_cast<double>(NumItems[0]) / NumRolls;
+	const double AliasAverage = static_cast<double>(NumItems[1]) / NumRolls;
+	TestTrue(TEXT("Average drop count matches the per copy roll"),
+	         FMath::Abs(PerCopyAverage - AliasAverage) < 0.01 * PerCopyAverage);
+
+	UE_LOG(LogAura, Display, TEXT("Rolled loot %d times: %.1f ms per copy (%.3f items), %.1f ms from the alias tables (%.3f items)"),
+	       NumRolls, Seconds[0] * 1000.0, PerCopyAverage, Seconds[1] * 1000.0, AliasAverage);
+	AddInfo(FString::Printf(TEXT("Per copy %.1f ms, alias tables %.1f ms"), Seconds[0] * 1000.0, Seconds[1] * 1000.0));
+	return true;
+}
+
+#endif
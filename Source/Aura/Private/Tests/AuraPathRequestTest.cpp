@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NavigationSystem.h"
+#include "Components/BrushComponent.h"
+#include "Components/SplineComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "NavMesh/NavMeshBoundsVolume.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Player/AuraControllerCoreComponent.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraPathRequestTest
+{
+	/** Half the side of the square floor, in uu */
+	constexpr float HalfExtent = 10000.f;
+	/** Walls across the floor, each leaving a gap at alternating ends so the paths snake through all of them */
+	constexpr int32 NumWalls = 9;
+	constexpr float GapWidth = 1000.f;
+	constexpr int32 NumClicks = 20;
+	constexpr int32 MaxFramesPerPath = 60;
+
+	/** Engine cube, 100 uu on a side, centered on Location */
+	static void SpawnBlock(FAuraTestWorld& TestWorld, UStaticMesh* Cube, const FVector& Location, const FVector& Size)
+	{
+		AStaticMeshActor* Block = TestWorld.Spawn<AStaticMeshActor>(
+			AStaticMeshActor::StaticClass(), FTransform(FRotator::ZeroRotator, Location, Size / 100.f));
+		// A static mesh can't be swapped on a static component once the world has begun play
+		Block->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+		Block->GetStaticMeshComponent()->SetStaticMesh(Cube);
+	}
+
+	static void SpawnMaze(FAuraTestWorld& TestWorld)
+	{
+		UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		SpawnBlock(TestWorld, Cube, FVector(0.f, 0.f, -50.f), FVector(2.f * HalfExtent, 2.f * HalfExtent, 100.f));
+
+		const float WallSpacing = 2.f * HalfExtent / (NumWalls + 1);
+		for (int32 Wall = 1; Wall <= NumWalls; ++Wall)
+		{
+			const float GapSide = Wall % 2 == 0 ? 1.f : -1.f;
+			const FVector Location(-GapSide * GapWidth / 2.f, -HalfExtent + Wall * WallSpacing, 150.f);
+			SpawnBlock(TestWorld, Cube, Location, FVector(2.f * HalfExtent - GapWidth, 50.f, 300.f));
+		}
+	}
+
+	/** Bounds volume around the whole floor, its box given as collision since there is no brush to build at runtime */
+	static void SpawnNavBounds(FAuraTestWorld& TestWorld, UNavigationSystemV1* NavSys)
+	{
+		ANavMeshBoundsVolume* Bounds = TestWorld.Spawn<ANavMeshBoundsVolume>();
+		UBrushComponent* BrushComponent = Bounds->GetBrushComponent();
+		BrushComponent->BrushBodySetup = NewObject<UBodySetup>(BrushComponent);
+		BrushComponent->BrushBodySetup->AggGeom.BoxElems.Add(
+			FKBoxElem(2.f * HalfExtent + GapWidth, 2.f * HalfExtent + GapWidth, 1000.f));
+		BrushComponent->UpdateBounds();
+		NavSys->OnNavigationBoundsUpdated(Bounds);
+	}
+
+	/** The default navmesh only generates in editor worlds unless it is set to runtime generation */
+	static FProperty* GetRuntimeGenerationProperty()
+	{
+		return FindFProperty<FProperty>(ANavigationData::StaticClass(), TEXT("RuntimeGeneration"));
+	}
+
+	static FVector GetDestination(int32 Click)
+	{
+		const float Corner = HalfExtent - GapWidth / 2.f;
+		return FVector(Click % 2 == 0 ? Corner : -Corner, Corner, 0.f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraPathRequestBenchmark, "Aura.Player.ClickToMoveOnLargeNavMesh",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraPathRequestBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace AuraPathRequestTest;
+
+	FAuraTestWorld TestWorld;
+	FNavigationSystem::AddNavigationSystemToWorld(*TestWorld.World, FNavigationSystemRunMode::GameMode);
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(TestWorld.World);
+	if (!TestNotNull(TEXT("Navigation system"), NavSys)) return false;
+
+	FProperty* RuntimeGeneration = GetRuntimeGenerationProperty();
+	if (!TestNotNull(TEXT("RuntimeGeneration"), RuntimeGeneration)) return false;
+	uint8* DefaultGeneration = RuntimeGeneration->ContainerPtrToValuePtr<uint8>(GetMutableDefault<ARecastNavMesh>());
+	const uint8 PreviousGeneration = *DefaultGeneration;
+	*DefaultGeneration = static_cast<uint8>(ERuntimeGenerationType::Dynamic);
+
+	SpawnMaze(TestWorld);
+	SpawnNavBounds(TestWorld, NavSys);
+	double BuildSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(BuildSeconds);
+		NavSys->Build();
+	}
+	*DefaultGeneration = PreviousGeneration;
+	if (!TestNotNull(TEXT("Navmesh"), NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate))) return false;
+
+	const FVector Start(-HalfExtent + GapWidth / 2.f, -HalfExtent + GapWidth / 2.f, 100.f);
+	APlayerController* PlayerController = TestWorld.SpawnLocalPlayer(Start);
+	USplineComponent* Spline = NewObject<USplineComponent>(PlayerController);
+	Spline->RegisterComponent();
+	UAuraControllerCoreComponent* ControllerCore = NewObject<UAuraControllerCoreComponent>(PlayerController);
+	ControllerCore->RegisterComponent();
+	ControllerCore->Setup(Spline, nullptr, 50.f, nullptr, nullptr);
+
+	const FStructProperty* DestinationProperty = FindFProperty<FStructProperty>(
+		UAuraControllerCoreComponent::StaticClass(), TEXT("CachedDestination"));
+	FVector* CachedDestination = DestinationProperty->ContainerPtrToValuePtr<FVector>(ControllerCore);
+
+	// Click-to-move: the click frame, then every frame until the path replaces the straight segment
+	double AsyncSeconds = 0.0;
+	double AsyncMaxFrameSeconds = 0.0;
+	int32 AsyncFrames = 0;
+	int32 NumPathsFound = 0;
+	int32 NumPathPoints = 0;
+	for (int32 Click = 0; Click < NumClicks; ++Click)
+	{
+		*CachedDestination = GetDestination(Click);
+		for (int32 Frame = 0; Frame < MaxFramesPerPath; ++Frame)
+		{
+			double FrameSeconds = 0.0;
+			{
+				FSimpleScopeSecondsCounter Counter(FrameSeconds);
+				if (Frame == 0)
+				{
+					ControllerCore->ReleaseFollowCursor();
+				}
+				TestWorld.Tick();
+			}
+			AsyncSeconds += FrameSeconds;
+			AsyncMaxFrameSeconds = FMath::Max(AsyncMaxFrameSeconds, FrameSeconds);
+			++AsyncFrames;
+
+			// The maze has no straight path between the corners
+			if (Spline->GetNumberOfSplinePoints() > 2)
+			{
+				++NumPathsFound;
+				NumPathPoints = Spline->GetNumberOfSplinePoints();
+				break;
+			}
+		}
+	}
+	TestEqual(TEXT("Every click gets its path"), NumPathsFound, NumClicks);
+
+	// What a click did before: the whole path found on the game thread within the click frame
+	double SyncSeconds = 0.0;
+	double SyncMaxFrameSeconds = 0.0;
+	for (int32 Click = 0; Click < NumClicks; ++Click)
+	{
+		double FrameSeconds = 0.0;
+		{
+			FSimpleScopeSecondsCounter Counter(FrameSeconds);
+			UNavigationSystemV1::FindPathToLocationSynchronously(TestWorld.World, Start, GetDestination(Click));
+			TestWorld.Tick();
+		}
+		SyncSeconds += FrameSeconds;
+		SyncMaxFrameSeconds = FMath::Max(SyncMaxFrameSeconds, FrameSeconds);
+	}
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%.0f uu navmesh through %d walls built in %.1f ms, paths of %d points. ")
+		TEXT("Async: %.3f ms per frame, %.3f ms worst frame, %.1f frames per path. ")
+		TEXT("Synchronous: %.3f ms per click frame, %.3f ms worst frame"),
+		2.f * HalfExtent, NumWalls, BuildSeconds * 1000.0, NumPathPoints,
+		AsyncSeconds * 1000.0 / FMath::Max(AsyncFrames, 1), AsyncMaxFrameSeconds * 1000.0,
+		static_cast<double>(AsyncFrames) / NumClicks, SyncSeconds * 1000.0 / NumClicks, SyncMaxFrameSeconds * 1000.0));
+	return true;
+}
+
+#endif
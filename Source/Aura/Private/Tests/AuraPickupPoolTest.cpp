@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Actor/AuraEffectActor.h"
+#include "Game/AuraPickupPoolSubsystem.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraPickupPoolTest
+{
+	/** The level is protected, read it the way the details panel does */
+	static float GetActorLevel(const AAuraEffectActor* Pickup)
+	{
+		const FFloatProperty* Property = FindFProperty<FFloatProperty>(AAuraEffectActor::StaticClass(),
+		                                                               TEXT("ActorLevel"));
+		return Property->GetPropertyValue_InContainer(Pickup);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraPickupPoolLevelTest, "Aura.Pickups.PooledPickupsResetLevel",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraPickupPoolLevelTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraPickupPoolTest;
+
+	FAuraTestWorld TestWorld;
+	UAuraPickupPoolSubsystem* PickupPool = TestWorld.World->GetSubsystem<UAuraPickupPoolSubsystem>();
+	if (!TestNotNull(TEXT("Pickup pool"), PickupPool)) return false;
+
+	AAuraEffectActor* Pickup = Cast<AAuraEffectActor>(
+		PickupPool->AcquirePickup(AAuraEffectActor::StaticClass(), FTransform::Identity));
+	if (!TestNotNull(TEXT("Pickup"), Pickup)) return false;
+	const float ClassLevel = GetActorLevel(GetDefault<AAuraEffectActor>());
+
+	// Dropped by a high level enemy with a level override, then picked up
+	Pickup->SetActorLevel(ClassLevel + 10.f);
+	PickupPool->ReleasePickup(Pickup);
+
+	// Dropped again as loot that keeps the class level
+	AAuraEffectActor* Reused = Cast<AAuraEffectActor>(
+		PickupPool->AcquirePickup(AAuraEffectActor::StaticClass(), FTransform::Identity));
+	TestTrue(TEXT("Pickup comes back from the pool"), Reused == Pickup);
+	if (Reused)
+	{
+		TestEqual(TEXT("Reused pickup drops at the class level"), GetActorLevel(Reused), ClassLevel);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,169 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Actor/AuraEffectActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpressionScalarParameter.h"
+#include "Tests/AuraTestWorld.h"
+#include "UObject/Package.h"
+
+namespace AuraPickupTickTest
+{
+	constexpr int32 NumPickups = 2000;
+	constexpr int32 NumFrames = 120;
+	constexpr int32 GridWidth = 50;
+	constexpr float GridSpacing = 200.f;
+
+	static TArray<AAuraEffectActor*> SpawnPickups(FAuraTestWorld& TestWorld)
+	{
+		TArray<AAuraEffectActor*> Pickups;
+		Pickups.Reserve(NumPickups);
+		for (int32 i = 0; i < NumPickups; ++i)
+		{
+			const FVector Location((i % GridWidth) * GridSpacing, (i / GridWidth) * GridSpacing, 0.f);
+			Pickups.Add(TestWorld.Spawn<AAuraEffectActor>(AAuraEffectActor::StaticClass(), FTransform(Location)));
+		}
+		return Pickups;
+	}
+
+	/** In the middle of the grid, so some of the pickups are within tick distance and most are not */
+	static void SpawnLocalPlayerAmongPickups(FAuraTestWorld& TestWorld)
+	{
+		const int32 NumRows = NumPickups / GridWidth;
+		TestWorld.SpawnLocalPlayer(FVector(GridWidth * GridSpacing / 2.f, NumRows * GridSpacing / 2.f, 0.f));
+	}
+
+	/** The movement flags are protected, set them the way the Blueprint defaults would */
+	static void SetMovementFlag(AAuraEffectActor* Pickup, FName PropertyName)
+	{
+		FBoolProperty* Property = FindFProperty<FBoolProperty>(AAuraEffectActor::StaticClass(), PropertyName);
+		Property->SetPropertyValue_InContainer(Pickup, true);
+	}
+
+	/** Starts the movement through the Blueprint entry points */
+	static void StartMovement(AAuraEffectActor* Pickup)
+	{
+		Pickup->ProcessEvent(Pickup->FindFunctionChecked(TEXT("StartRotation")), nullptr);
+		Pickup->ProcessEvent(Pickup->FindFunctionChecked(TEXT("StartSinusoidalMovement")), nullptr);
+	}
+
+	static int32 CountTicking(const TArray<AAuraEffectActor*>& Pickups)
+	{
+		int32 NumTicking = 0;
+		for (const AAuraEffectActor* Pickup : Pickups)
+		{
+			NumTicking += Pickup->IsActorTickEnabled() ? 1 : 0;
+		}
+		return NumTicking;
+	}
+
+#if WITH_EDITOR
+	/**
+	 * Material with the custom primitive data parameters the pickup movement material reads.
+	 * Only the parameters matter here, the world position offset they drive runs on the GPU.
+	 */
+	static UMaterial* CreateMovementMaterial()
+	{
+		UMaterial* Material = NewObject<UMaterial>(GetTransientPackage());
+		const FName ParameterNames[] = {
+			FName("BobAmplitude"), FName("BobFrequency"), FName("SpinRate"), FName("MovementStartTime")
+		};
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(ParameterNames); ++Index)
+		{
+			UMaterialExpressionScalarParameter* Parameter = NewObject<UMaterialExpressionScalarParameter>(Material);
+			Parameter->ParameterName = ParameterNames[Index];
+			Parameter->bUseCustomPrimitiveData = true;
+			Parameter->PrimitiveDataIndex = Index;
+			Material->GetExpressionCollection().AddExpression(Parameter);
+		}
+		Material->UpdateCachedExpressionData();
+		return Material;
+	}
+
+	static void AddMesh(AAuraEffectActor* Pickup, UStaticMesh* Mesh, UMaterialInterface* Material)
+	{
+		UStaticMeshComponent* MeshComponent = NewObject<UStaticMeshComponent>(Pickup);
+		MeshComponent->SetStaticMesh(Mesh);
+		MeshComponent->SetMaterial(0, Material);
+		MeshComponent->SetupAttachment(Pickup->GetRootComponent());
+		MeshComponent->RegisterComponent();
+	}
+#endif
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraPickupTickTest, "Aura.Pickups.TwoThousandPickupsDontTick",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraPickupTickTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraPickupTickTest;
+
+	// Every pickup bobbing and spinning from its own tick, the way they moved before
+	double TickingSeconds = 0.0;
+	{
+		FAuraTestWorld TestWorld;
+		for (AAuraEffectActor* Pickup : SpawnPickups(TestWorld))
+		{
+			SetMovementFlag(Pickup, TEXT("bRotates"));
+			SetMovementFlag(Pickup, TEXT("bSinusoidalMovement"));
+			Pickup->SetActorTickEnabled(true);
+		}
+		TickingSeconds = TestWorld.TickFrames(NumFrames);
+	}
+
+	// Meshes without the movement material: only the pickups near the local player tick
+	double FallbackSeconds = 0.0;
+	int32 NumFallbackTicking = 0;
+	{
+		FAuraTestWorld TestWorld;
+		SpawnLocalPlayerAmongPickups(TestWorld);
+		const TArray<AAuraEffectActor*> Pickups = SpawnPickups(TestWorld);
+		for (AAuraEffectActor* Pickup : Pickups)
+		{
+			StartMovement(Pickup);
+		}
+		FallbackSeconds = TestWorld.TickFrames(NumFrames);
+
+		NumFallbackTicking = CountTicking(Pickups);
+		TestTrue(TEXT("Pickups near the local player move on the CPU"), NumFallbackTicking > 0);
+		TestTrue(TEXT("Pickups away from the local player don't tick"), NumFallbackTicking < NumPickups);
+	}
+
+	double MaterialSeconds = 0.0;
+#if WITH_EDITOR
+	// Meshes with the movement material: nothing ticks, near the local player or not
+	{
+		UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+		UMaterial* Material = CreateMovementMaterial();
+
+		FAuraTestWorld TestWorld;
+		SpawnLocalPlayerAmongPickups(TestWorld);
+		const TArray<AAuraEffectActor*> Pickups = SpawnPickups(TestWorld);
+		for (AAuraEffectActor* Pickup : Pickups)
+		{
+			AddMesh(Pickup, Mesh, Material);
+			StartMovement(Pickup);
+		}
+		MaterialSeconds = TestWorld.TickFrames(NumFrames);
+
+		TestEqual(TEXT("Pickups moved by their material don't tick"), CountTicking(Pickups), 0);
+		const UStaticMeshComponent* MeshComponent = Pickups[0]->FindComponentByClass<UStaticMeshComponent>();
+		TestTrue(TEXT("Movement is pushed to the material"),
+		         MeshComponent && MeshComponent->GetCustomPrimitiveData().Data.Num() >= 4);
+	}
+#endif
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d pickups over %d frames: %.2f ms per frame all ticking, %.2f ms per frame on the CPU fallback ")
+		TEXT("(%d near the player ticking), %.2f ms per frame on the movement material"),
+		NumPickups, NumFrames, TickingSeconds * 1000.0 / NumFrames, FallbackSeconds * 1000.0 / NumFrames,
+		NumFallbackTicking, MaterialSeconds * 1000.0 / NumFrames));
+	return true;
+}
+
+#endif
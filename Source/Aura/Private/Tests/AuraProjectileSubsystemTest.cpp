@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Actor/AuraProjectile.h"
+#include "Game/AuraProjectileSubsystem.h"
+#include "Tests/AuraTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraProjectileSubsystemTest, "Aura.Projectiles.TwoThousandLightweightProjectiles",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraProjectileSubsystemTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumProjectiles = 2000;
+	constexpr int32 NumFrames = 60;
+
+	// Fanned out over a circle so no two share a path
+	auto GetLaunchRotation = [](int32 Index)
+	{
+		return FRotator(0.f, 360.f * Index / NumProjectiles, 0.f);
+	};
+
+	// One actor per projectile, each with its own sphere and movement component
+	double ActorSeconds = 0.0;
+	{
+		FAuraTestWorld TestWorld;
+		for (int32 i = 0; i < NumProjectiles; ++i)
+		{
+			TestWorld.Spawn<AAuraProjectile>(AAuraProjectile::StaticClass(), FTransform(GetLaunchRotation(i)));
+		}
+		ActorSeconds = TestWorld.TickFrames(NumFrames);
+	}
+
+	FAuraTestWorld TestWorld;
+	UAuraProjectileSubsystem* Projectiles = TestWorld.World->GetSubsystem<UAuraProjectileSubsystem>();
+	if (!TestNotNull(TEXT("Projectile subsystem"), Projectiles)) return false;
+
+	AActor* SourceActor = TestWorld.Spawn<AActor>();
+	for (int32 i = 0; i < NumProjectiles; ++i)
+	{
+		Projectiles->LaunchProjectile(AAuraProjectile::StaticClass(), FVector::ZeroVector,
+		                              GetLaunchRotation(i).Vector(), SourceActor, FDamageEffectParams());
+	}
+	TestEqual(TEXT("Every launch is simulated"), Projectiles->GetNumProjectiles(), NumProjectiles);
+
+	const double LightweightSeconds = TestWorld.TickFrames(NumFrames);
+	TestEqual(TEXT("Nothing to hit in an empty world"), Projectiles->GetNumProjectiles(), NumProjectiles);
+
+	// Step past the life span of the projectile defaults
+	const float LifeSpan = GetDefault<AAuraProjectile>()->GetProjectileLifeSpan();
+	TestWorld.TickFrames(FMath::CeilToInt(LifeSpan) + 1, 1.f);
+	TestEqual(TEXT("Projectiles end with their life span"), Projectiles->GetNumProjectiles(), 0);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d projectiles over %d frames: %.2f ms per frame as actors, %.2f ms per frame lightweight"),
+		NumProjectiles, NumFrames, ActorSeconds * 1000.0 / NumFrames, LightweightSeconds * 1000.0 / NumFrames));
+	return true;
+}
+
+#endif
@@ -0,0 +1,244 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Aura/AuraLogChannels.h"
+#include "Actor/AuraEnemySpawnVolume.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Checkpoint/Checkpoint.h"
+#include "Game/AuraSaveGameArchive.h"
+#include "Game/LoadScreenSaveGame.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraSaveGameArchiveTest
+{
+	static void SpawnSaveActors(FAuraTestWorld& TestWorld, int32 NumActors, TArray<AActor*>& OutActors,
+	                            FSavedMap& OutFixture)
+	{
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			if (i % 2 == 0)
+			{
+				ACheckpoint* Checkpoint = TestWorld.Spawn<ACheckpoint>();
+				Checkpoint->bReached = i % 3 == 0;
+				OutActors.Add(Checkpoint);
+			}
+			else
+			{
+				OutActors.Add(TestWorld.Spawn<AAuraEnemySpawnVolume>());
+			}
+		}
+
+		OutFixture.MapAssetName = TEXT("AuraTestWorld");
+		for (const AActor* Actor : OutActors)
+		{
+			FSavedActor& SavedActor = OutFixture.SavedActors.AddDefaulted_GetRef();
+			SavedActor.ActorName = Actor->GetFName();
+			SavedActor.Transform = Actor->GetTransform();
+		}
+	}
+
+	static IConsoleVariable* FindSerializeChunks()
+	{
+		return IConsoleManager::Get().FindConsoleVariable(TEXT("Aura.Save.SerializeChunks"));
+	}
+
+	/** Save and load of the current format, packed with FormatName */
+	struct FPackedRun
+	{
+		double SaveSeconds = 0.0;
+		double LoadSeconds = 0.0;
+		int32 RawSize = 0;
+		int32 StoredSize = 0;
+		bool bLoaded = true;
+	};
+
+	static FPackedRun SaveAndLoad(const TArray<AActor*>& Actors, const FSavedMap& Fixture, FName FormatName)
+	{
+		FPackedRun Run;
+		FSavedMap SavedMap = Fixture;
+		{
+			FSimpleScopeSecondsCounter Counter(Run.SaveSeconds);
+			TArray<uint8> RawBytes;
+			FAuraSaveCodec::SerializeActors(Actors, SavedMap, RawBytes);
+			FAuraSaveCodec::PackActorBytes(SavedMap, RawBytes, FormatName);
+		}
+		Run.RawSize = SavedMap.UncompressedSize;
+		Run.StoredSize = SavedMap.ActorBytes.Num();
+
+		FSimpleScopeSecondsCounter Counter(Run.LoadSeconds);
+		TArray<uint8> DecompressedBytes;
+		TConstArrayView<uint8> RawBytes;
+		Run.bLoaded = FAuraSaveCodec::UnpackActorBytes(SavedMap, DecompressedBytes, RawBytes);
+		for (int32 i = 0; Run.bLoaded && i < Actors.Num(); ++i)
+		{
+			Run.bLoaded = FAuraSaveCodec::DeserializeActor(Actors[i], SavedMap.SavedActors[i], SavedMap, RawBytes);
+		}
+		return Run;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSaveSerialParallelTest, "Aura.Save.SerialMatchesParallel",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSaveSerialParallelTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraSaveGameArchiveTest;
+
+	constexpr int32 NumActors = 1000;
+
+	FAuraTestWorld TestWorld;
+	TArray<AActor*> Actors;
+	FSavedMap Fixture;
+	SpawnSaveActors(TestWorld, NumActors, Actors, Fixture);
+
+	IConsoleVariable* SerializeChunks = FindSerializeChunks();
+	if (!TestNotNull(TEXT("Aura.Save.SerializeChunks"), SerializeChunks)) return false;
+	const int32 PreviousChunks = SerializeChunks->GetInt();
+	SerializeChunks->Set(8, ECVF_SetByCode);
+
+	FSavedMap SerialMap = Fixture;
+	TArray<uint8> SerialBytes;
+	double SerialSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(SerialSeconds);
+		FAuraSaveCodec::SerializeActorsSerial(Actors, SerialMap, SerialBytes);
+	}
+
+	FSavedMap ParallelMap = Fixture;
+	TArray<uint8> ParallelBytes;
+	double ParallelSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(ParallelSeconds);
+		FAuraSaveCodec::SerializeActors(Actors, ParallelMap, ParallelBytes);
+	}
+
+	SerializeChunks->Set(PreviousChunks, ECVF_SetByCode);
+
+	UE_LOG(LogAura, Display, TEXT("Serialized %d actors: serial %.3f ms, parallel %.3f ms, %d bytes"), NumActors,
+	       SerialSeconds * 1000.0, ParallelSeconds * 1000.0, ParallelBytes.Num());
+
+	TestTrue(TEXT("Actor bytes match"), SerialBytes == ParallelBytes);
+	TestTrue(TEXT("Name tables match"), SerialMap.NameTable == ParallelMap.NameTable);
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		const FSavedActor& Serial = SerialMap.SavedActors[i];
+		const FSavedActor& Parallel = ParallelMap.SavedActors[i];
+		if (Serial.BytesOffset != Parallel.BytesOffset || Serial.BytesNum != Parallel.BytesNum ||
+			Serial.NameIndices != Parallel.NameIndices)
+		{
+			AddError(FString::Printf(TEXT("Actor %d [%s] differs between the serial and parallel paths"), i,
+			                         *Serial.ActorName.ToString()));
+		}
+	}
+
+	// The merged output has to load back into the actors it came from
+	ParallelMap.SaveFormatVersion = FAuraSaveCodec::CurrentSaveFormatVersion;
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		TestTrue(TEXT("Actor deserializes"),
+		         FAuraSaveCodec::DeserializeActor(Actors[i], ParallelMap.SavedActors[i], ParallelMap, ParallelBytes));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSaveTenThousandActorsTest, "Aura.Save.TenThousandActors",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraSaveTenThousandActorsTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraSaveGameArchiveTest;
+
+	constexpr int32 NumActors = 10000;
+
+	FAuraTestWorld TestWorld;
+	TArray<AActor*> Actors;
+	FSavedMap Fixture;
+	SpawnSaveActors(TestWorld, NumActors, Actors, Fixture);
+
+	// Format 0: every actor written with AActor::Serialize into its own inline bytes, names as strings
+	FSavedMap InlineMap = Fixture;
+	double InlineSaveSeconds = 0.0;
+	int32 InlineSize = 0;
+	{
+		FSimpleScopeSecondsCounter Counter(InlineSaveSeconds);
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			FMemoryWriter MemoryWriter(InlineMap.SavedActors[i].Bytes);
+			FObjectAndNameAsStringProxyArchive Archive(MemoryWriter, true);
+			Archive.ArIsSaveGame = true;
+			Actors[i]->Serialize(Archive);
+		}
+	}
+	for (const FSavedActor& SavedActor : InlineMap.SavedActors)
+	{
+		InlineSize += SavedActor.Bytes.Num();
+	}
+
+	double InlineLoadSeconds = 0.0;
+	{
+		FSimpleScopeSecondsCounter Counter(InlineLoadSeconds);
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			if (!FAuraSaveCodec::DeserializeActor(Actors[i], InlineMap.SavedActors[i], InlineMap, {}))
+			{
+				AddError(FString::Printf(TEXT("Format 0 actor %d failed to load"), i));
+				break;
+			}
+		}
+	}
+
+	// Chunk count of the parallel serialization, each chunk is one task on a free worker
+	IConsoleVariable* SerializeChunks = FindSerializeChunks();
+	if (!TestNotNull(TEXT("Aura.Save.SerializeChunks"), SerializeChunks)) return false;
+	const int32 PreviousChunks = SerializeChunks->GetInt();
+	const int32 ChunkCounts[] = {0, 1, 4, 8};
+	for (const int32 NumChunks : ChunkCounts)
+	{
+		SerializeChunks->Set(NumChunks, ECVF_SetByCode);
+		FSavedMap ChunkedMap = Fixture;
+		TArray<uint8> RawBytes;
+		double SerializeSeconds = 0.0;
+		{
+			FSimpleScopeSecondsCounter Counter(SerializeSeconds);
+			FAuraSaveCodec::SerializeActors(Actors, ChunkedMap, RawBytes);
+		}
+		AuraTest::AddMeasurement(*this, FString::Printf(
+			TEXT("%d actors, %d serialize chunks on %d task graph workers: %.2f ms"),
+			NumActors, NumChunks, FTaskGraphInterface::Get().GetNumWorkerThreads(), SerializeSeconds * 1000.0));
+	}
+	SerializeChunks->Set(PreviousChunks, ECVF_SetByCode);
+
+	const FPackedRun Raw = SaveAndLoad(Actors, Fixture, NAME_None);
+	const FPackedRun Oodle = SaveAndLoad(Actors, Fixture, NAME_Oodle);
+	const FPackedRun Zlib = SaveAndLoad(Actors, Fixture, NAME_Zlib);
+	TestTrue(TEXT("Raw actor bytes load"), Raw.bLoaded);
+	TestTrue(TEXT("Oodle actor bytes load"), Oodle.bLoaded);
+	TestTrue(TEXT("Zlib actor bytes load"), Zlib.bLoaded);
+	TestEqual(TEXT("Raw actor bytes are stored as is"), Raw.StoredSize, Raw.RawSize);
+	TestTrue(TEXT("Oodle stores fewer bytes than raw"), Oodle.StoredSize < Oodle.RawSize);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d actors, format 0: save %.2f ms, load %.2f ms, %d bytes"),
+		NumActors, InlineSaveSeconds * 1000.0, InlineLoadSeconds * 1000.0, InlineSize));
+	const TPair<const TCHAR*, const FPackedRun*> Runs[] = {
+		{TEXT("raw"), &Raw}, {TEXT("Oodle"), &Oodle}, {TEXT("Zlib"), &Zlib}
+	};
+	for (const TPair<const TCHAR*, const FPackedRun*>& Run : Runs)
+	{
+		AuraTest::AddMeasurement(*this, FString::Printf(
+			TEXT("%d actors, format %d %s: save %.2f ms, load %.2f ms, %d bytes raw, %d bytes stored (%.1f%%)"),
+			NumActors, FAuraSaveCodec::CurrentSaveFormatVersion, Run.Key, Run.Value->SaveSeconds * 1000.0,
+			Run.Value->LoadSeconds * 1000.0, Run.Value->RawSize, Run.Value->StoredSize,
+			Run.Value->RawSize > 0 ? 100.0 * Run.Value->StoredSize / Run.Value->RawSize : 0.0));
+	}
+	return true;
+}
+
+#endif
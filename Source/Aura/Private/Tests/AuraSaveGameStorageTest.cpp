@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Game/AuraSaveGameStorage.h"
+#include "Game/LoadScreenSaveGame.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryWriter.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSaveTruncatedWriteTest, "Aura.Save.TruncatedWriteFallsBackToBackup",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSaveTruncatedWriteTest::RunTest(const FString& Parameters)
+{
+	const FString SlotName = TEXT("AuraTruncatedWriteTest");
+	constexpr int32 UserIndex = 0;
+
+	IConsoleVariable* SimulateTruncatedWrite = IConsoleManager::Get().FindConsoleVariable(TEXT("Aura.Save.SimulateTruncatedWrite"));
+	if (!TestNotNull(TEXT("Aura.Save.SimulateTruncatedWrite"), SimulateTruncatedWrite)) return false;
+
+	FAuraSaveGameStorage::DeleteGameInSlot(SlotName, UserIndex);
+
+	ULoadScreenSaveGame* SaveGame = NewObject<ULoadScreenSaveGame>();
+	SaveGame->PlayerName = TEXT("Good Write");
+	TestTrue(TEXT("Good write succeeds"), FAuraSaveGameStorage::SaveGameToSlot(SaveGame, SlotName, UserIndex));
+
+	// A truncated write of a fresh slot has no backup to fall back to and must not load at all
+	const FString FreshSlotName = SlotName + TEXT("_Fresh");
+	FAuraSaveGameStorage::DeleteGameInSlot(FreshSlotName, UserIndex);
+	SimulateTruncatedWrite->Set(true, ECVF_SetByCode);
+	SaveGame->PlayerName = TEXT("Truncated Write");
+	FAuraSaveGameStorage::SaveGameToSlot(SaveGame, FreshSlotName, UserIndex);
+	FAuraSaveGameStorage::SaveGameToSlot(SaveGame, SlotName, UserIndex);
+	SimulateTruncatedWrite->Set(false, ECVF_SetByCode);
+
+	TestNull(TEXT("Truncated slot without backup is rejected"),
+	         FAuraSaveGameStorage::LoadGameFromSlot(FreshSlotName, UserIndex));
+
+	const ULoadScreenSaveGame* Loaded = Cast<ULoadScreenSaveGame>(FAuraSaveGameStorage::LoadGameFromSlot(SlotName, UserIndex));
+	if (TestNotNull(TEXT("Truncated slot falls back to its backup"), Loaded))
+	{
+		TestEqual(TEXT("Backup holds the last good write"), Loaded->PlayerName, FString(TEXT("Good Write")));
+	}
+
+	FAuraSaveGameStorage::DeleteGameInSlot(SlotName, UserIndex);
+	FAuraSaveGameStorage::DeleteGameInSlot(FreshSlotName, UserIndex);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSaveOlderStorageTest, "Aura.Save.OlderStorageVersionsLoad",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSaveOlderStorageTest::RunTest(const FString& Parameters)
+{
+	const FString SlotName = TEXT("AuraOlderStorageTest");
+	constexpr int32 UserIndex = 0;
+
+	ULoadScreenSaveGame* SaveGame = NewObject<ULoadScreenSaveGame>();
+	SaveGame->PlayerName = TEXT("Older Storage");
+	TArray<uint8> Payload;
+	if (!TestTrue(TEXT("Save game serializes"), UGameplayStatics::SaveGameToMemory(SaveGame, Payload))) return false;
+
+	// Storage version 1: the SaveGameToMemory payload between the "ASVH" header and the "ASVC" CRC footer
+	TArray<uint8> Enveloped;
+	FMemoryWriter Writer(Enveloped);
+	uint32 Magic = 0x48565341;
+	uint32 Version = 1;
+	Writer << Magic << Version;
+	Writer.Serialize(Payload.GetData(), Payload.Num());
+	uint32 Crc = FCrc::MemCrc32(Enveloped.GetData(), Enveloped.Num());
+	Magic = 0x41535643;
+	Writer << Magic << Crc;
+
+	struct FCase
+	{
+		const TCHAR* Name;
+		const TArray<uint8>& Data;
+	};
+	for (const FCase& Case : {FCase{TEXT("Slot written before the header"), Payload},
+	                          FCase{TEXT("Slot of storage version 1"), Enveloped}})
+	{
+		FAuraSaveGameStorage::DeleteGameInSlot(SlotName, UserIndex);
+		UGameplayStatics::SaveDataToSlot(Case.Data, SlotName, UserIndex);
+		const ULoadScreenSaveGame* Loaded = Cast<ULoadScreenSaveGame>(
+			FAuraSaveGameStorage::LoadGameFromSlot(SlotName, UserIndex));
+		if (TestNotNull(Case.Name, Loaded))
+		{
+			TestEqual(Case.Name, Loaded->PlayerName, SaveGame->PlayerName);
+		}
+	}
+
+	FAuraSaveGameStorage::DeleteGameInSlot(SlotName, UserIndex);
+	return true;
+}
+
+#endif
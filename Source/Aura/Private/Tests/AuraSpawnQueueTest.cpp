@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EngineUtils.h"
+#include "Actor/AuraEnemySpawnPoint.h"
+#include "Character/AuraEnemy.h"
+#include "Game/AuraSpawnQueueSubsystem.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraSpawnQueueTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+	static const TCHAR* EnemyClassPath = TEXT("/Game/Blueprints/Character/Goblin_Spear/BP_Goblin_Spear.BP_Goblin_Spear_C");
+
+	constexpr int32 NumSpawnPoints = 100;
+	constexpr int32 MaxFrames = 1000;
+	/** Frame to frame noise allowed on top of the budget, the budget itself is only checked between spawns */
+	constexpr double ToleranceMs = 0.5;
+
+	static TArray<AAuraEnemySpawnPoint*> SpawnPoints(FAuraTestWorld& TestWorld, UClass* EnemyClass)
+	{
+		TArray<AAuraEnemySpawnPoint*> Points;
+		for (int32 i = 0; i < NumSpawnPoints; ++i)
+		{
+			const FVector Location((i % 10) * 300.f, (i / 10) * 300.f, 100.f);
+			AAuraEnemySpawnPoint* Point = TestWorld.Spawn<AAuraEnemySpawnPoint>(
+				AAuraEnemySpawnPoint::StaticClass(), FTransform(Location));
+			Point->EnemyClass = EnemyClass;
+			Points.Add(Point);
+		}
+		return Points;
+	}
+
+	static int32 CountEnemies(UWorld* World)
+	{
+		int32 NumEnemies = 0;
+		for (TActorIterator<AAuraEnemy> It(World); It; ++It)
+		{
+			++NumEnemies;
+		}
+		return NumEnemies;
+	}
+
+	/** The queue's settings are config values, read them the way DefaultGame.ini sets them */
+	template <typename TProperty>
+	static auto GetConfig(const UAuraSpawnQueueSubsystem* SpawnQueue, const TCHAR* PropertyName)
+	{
+		return FindFProperty<TProperty>(UAuraSpawnQueueSubsystem::StaticClass(), PropertyName)
+			->GetPropertyValue_InContainer(SpawnQueue);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSpawnQueueBudgetTest, "Aura.Enemies.DenseWaveSpawnBudget",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraSpawnQueueBudgetTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraSpawnQueueTest;
+
+	UClass* EnemyClass = LoadClass<AAuraEnemy>(nullptr, EnemyClassPath);
+	if (!TestNotNull(TEXT("Enemy class"), EnemyClass)) return false;
+
+	// The whole wave in one frame, the way spawn volumes did before the queue. Also gives the cost of one spawn.
+	double UnqueuedSeconds = 0.0;
+	double WorstSpawnMs = 0.0;
+	{
+		FAuraTestWorld TestWorld(GameModeClassPath);
+		for (AAuraEnemySpawnPoint* Point : SpawnPoints(TestWorld, EnemyClass))
+		{
+			double SpawnSeconds = 0.0;
+			{
+				FSimpleScopeSecondsCounter Counter(SpawnSeconds);
+				Point->SpawnEnemy();
+			}
+			UnqueuedSeconds += SpawnSeconds;
+			WorstSpawnMs = FMath::Max(WorstSpawnMs, SpawnSeconds * 1000.0);
+		}
+	}
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+	UAuraSpawnQueueSubsystem* SpawnQueue = TestWorld.World->GetSubsystem<UAuraSpawnQueueSubsystem>();
+	if (!TestNotNull(TEXT("Spawn queue"), SpawnQueue)) return false;
+	const int32 MaxSpawnsPerFrame = GetConfig<FIntProperty>(SpawnQueue, TEXT("MaxSpawnsPerFrame"));
+	const float SpawnBudgetMs = GetConfig<FFloatProperty>(SpawnQueue, TEXT("SpawnBudgetMs"));
+
+	SpawnQueue->QueueWave(SpawnPoints(TestWorld, EnemyClass), FVector::ZeroVector);
+
+	// Same steps as FAuraTestWorld::Tick, with only the queue's own tick timed
+	int32 NumFrames = 0;
+	int32 NumSpawned = 0;
+	int32 NumOverBudgetFrames = 0;
+	double QueueSeconds = 0.0;
+	double WorstFrameMs = 0.0;
+	while (SpawnQueue->IsTickable() && NumFrames < MaxFrames)
+	{
+		++GFrameCounter;
+		TestWorld.World->Tick(LEVELTICK_All, FAuraTestWorld::DefaultDeltaSeconds);
+
+		double FrameSeconds = 0.0;
+		{
+			FSimpleScopeSecondsCounter Counter(FrameSeconds);
+			SpawnQueue->Tick(FAuraTestWorld::DefaultDeltaSeconds);
+		}
+		++NumFrames;
+		QueueSeconds += FrameSeconds;
+		WorstFrameMs = FMath::Max(WorstFrameMs, FrameSeconds * 1000.0);
+
+		const int32 FrameSpawns = CountEnemies(TestWorld.World) - NumSpawned;
+		NumSpawned += FrameSpawns;
+		if (FrameSpawns > MaxSpawnsPerFrame)
+		{
+			AddError(FString::Printf(TEXT("Frame %d spawned %d enemies, the limit is %d"), NumFrames, FrameSpawns,
+			                         MaxSpawnsPerFrame));
+		}
+		// The budget is checked before each spawn after the first, so a frame can go over it by one spawn at most
+		if (FrameSeconds * 1000.0 > SpawnBudgetMs + ToleranceMs)
+		{
+			++NumOverBudgetFrames;
+			if (FrameSeconds * 1000.0 > SpawnBudgetMs + WorstSpawnMs + ToleranceMs)
+			{
+				AddError(FString::Printf(TEXT("Frame %d spent %.2f ms spawning, budget %.2f ms plus one spawn of %.2f ms"),
+				                         NumFrames, FrameSeconds * 1000.0, SpawnBudgetMs, WorstSpawnMs));
+			}
+		}
+	}
+	TestEqual(TEXT("The whole wave spawns"), NumSpawned, NumSpawnPoints);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("Wave of %d enemies: %.2f ms in one frame unqueued (%.2f ms worst spawn). ")
+		TEXT("Queued at %d per frame and %.2f ms: %d frames, %.3f ms per frame, %.3f ms worst, %d frames past the budget"),
+		NumSpawnPoints, UnqueuedSeconds * 1000.0, WorstSpawnMs, MaxSpawnsPerFrame, SpawnBudgetMs, NumFrames,
+		QueueSeconds * 1000.0 / FMath::Max(NumFrames, 1), WorstFrameMs, NumOverBudgetFrames));
+	return true;
+}
+
+#endif
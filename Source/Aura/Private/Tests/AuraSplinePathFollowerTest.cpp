@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/SplineComponent.h"
+#include "Player/AuraSplinePathFollower.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraSplinePathFollowerTest, "Aura.Input.SplinePathFollowerMatchesClosestKey",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraSplinePathFollowerTest::RunTest(const FString& Parameters)
+{
+	constexpr float StepDistance = 20.f;
+	constexpr float AcceptanceRadius = 50.f;
+	constexpr float MaxLocationError = 25.f;
+
+	USplineComponent* Spline = NewObject<USplineComponent>(GetTransientPackage());
+	Spline->ClearSplinePoints(false);
+	const TArray<FVector> Points = {
+		FVector(0.f, 0.f, 0.f), FVector(400.f, 0.f, 0.f), FVector(600.f, 300.f, 0.f),
+		FVector(600.f, 800.f, 0.f), FVector(200.f, 1000.f, 0.f), FVector(-300.f, 900.f, 0.f)
+	};
+	for (const FVector& Point : Points)
+	{
+		Spline->AddSplinePoint(Point, ESplineCoordinateSpace::World, false);
+	}
+	Spline->UpdateSpline();
+
+	// Walk the pawn along the spline and check the follower agrees with the full key search at every step
+	FAuraSplinePathFollower Follower;
+	Follower.Reset();
+	float PreviousKey = 0.f;
+	bool bReachedEnd = false;
+	for (float Distance = 0.f; Distance <= Spline->GetSplineLength(); Distance += StepDistance)
+	{
+		const FVector Location = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+
+		FVector Direction;
+		if (!Follower.Update(Spline, Location, AcceptanceRadius, Direction))
+		{
+			bReachedEnd = true;
+			TestTrue(TEXT("Stops only near the destination"),
+			         Spline->GetSplineLength() - Distance <= AcceptanceRadius + StepDistance);
+			break;
+		}
+
+		const float Key = Follower.GetInputKey();
+		TestTrue(TEXT("Input key never moves backwards"), Key >= PreviousKey);
+		PreviousKey = Key;
+
+		const FVector FollowerLocation = Spline->GetLocationAtSplineInputKey(Key, ESplineCoordinateSpace::World);
+		const FVector ClosestLocation = Spline->FindLocationClosestToWorldLocation(Location, ESplineCoordinateSpace::World);
+		if (FVector::Dist(FollowerLocation, ClosestLocation) > MaxLocationError)
+		{
+			AddError(FString::Printf(TEXT("At distance %.0f the follower is %.1f units from the closest point"),
+			                         Distance, FVector::Dist(FollowerLocation, ClosestLocation)));
+		}
+
+		const FVector Tangent = Spline->GetDirectionAtSplineInputKey(Key, ESplineCoordinateSpace::World);
+		TestTrue(TEXT("Direction follows the spline"), FVector::DotProduct(Direction, Tangent) > 0.9f);
+	}
+	TestTrue(TEXT("Follower reaches the end of the spline"), bReachedEnd);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,134 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Character/AuraEnemy.h"
+#include "Interaction/CombatInterface.h"
+#include "Serialization/BitWriter.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraStartupAbilitiesTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+
+	constexpr int32 NumEnemies = 300;
+
+	/** The ability list is protected, read it the way replication does */
+	static FGameplayAbilitySpecContainer& GetAbilityList(UAbilitySystemComponent* ASC)
+	{
+		const FStructProperty* Property = FindFProperty<FStructProperty>(UAbilitySystemComponent::StaticClass(),
+		                                                                 TEXT("ActivatableAbilities"));
+		return *Property->ContainerPtrToValuePtr<FGameplayAbilitySpecContainer>(ASC);
+	}
+
+	/** Replicated properties of the granted specs, object references are sent as net GUIDs on top of this */
+	static int64 GetSpecBits(UAbilitySystemComponent* ASC)
+	{
+		FBitWriter Writer(0, true);
+		for (FGameplayAbilitySpec& Spec : GetAbilityList(ASC).Items)
+		{
+			FGameplayAbilitySpec::StaticStruct()->SerializeBin(Writer, &Spec);
+		}
+		return Writer.GetNumBits();
+	}
+
+	struct FGrantResult
+	{
+		double Seconds = 0.0;
+		int32 NumDirtyMarks = 0;
+		int32 NumAbilities = 0;
+		int64 SpecBits = 0;
+	};
+
+	/** Clears every enemy's abilities and times Grant over all of them */
+	template<typename GrantType>
+	static FGrantResult MeasureGrant(const TArray<AAuraEnemy*>& Enemies, GrantType&& Grant)
+	{
+		TArray<int32> ReplicationKeys;
+		for (AAuraEnemy* Enemy : Enemies)
+		{
+			UAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent();
+			ASC->ClearAllAbilities();
+			ReplicationKeys.Add(GetAbilityList(ASC).ArrayReplicationKey);
+		}
+
+		FGrantResult Result;
+		{
+			FSimpleScopeSecondsCounter Counter(Result.Seconds);
+			for (AAuraEnemy* Enemy : Enemies)
+			{
+				Grant(Enemy);
+			}
+		}
+		for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+		{
+			UAbilitySystemComponent* ASC = Enemies[Index]->GetAbilitySystemComponent();
+			Result.NumDirtyMarks += GetAbilityList(ASC).ArrayReplicationKey - ReplicationKeys[Index];
+			Result.NumAbilities += ASC->GetActivatableAbilities().Num();
+			Result.SpecBits += GetSpecBits(ASC);
+		}
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraStartupAbilitiesTest, "Aura.Abilities.ThreeHundredEnemiesGrant",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FAuraStartupAbilitiesTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraStartupAbilitiesTest;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+
+	TArray<AAuraEnemy*> Enemies;
+	for (int32 i = 0; i < NumEnemies; ++i)
+	{
+		AAuraEnemy* Enemy = TestWorld.World->SpawnActorDeferred<AAuraEnemy>(
+			AAuraEnemy::StaticClass(), FTransform::Identity, nullptr, nullptr,
+			ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+		Enemy->SetCharacterClass(static_cast<ECharacterClass>(i % 3));
+		Enemy->FinishSpawning(FTransform::Identity);
+		Enemies.Add(Enemy);
+	}
+
+	// What each enemy was granted on spawn, replayed one GiveAbility at a time for the comparison
+	TMap<AAuraEnemy*, TArray<TPair<TSubclassOf<UGameplayAbility>, int32>>> GrantedAbilities;
+	for (AAuraEnemy* Enemy : Enemies)
+	{
+		for (const FGameplayAbilitySpec& Spec : Enemy->GetAbilitySystemComponent()->GetActivatableAbilities())
+		{
+			GrantedAbilities.FindOrAdd(Enemy).Emplace(Spec.Ability->GetClass(), Spec.Level);
+		}
+	}
+
+	const FGrantResult PerAbility = MeasureGrant(Enemies, [&GrantedAbilities](AAuraEnemy* Enemy)
+	{
+		for (const TPair<TSubclassOf<UGameplayAbility>, int32>& Granted : GrantedAbilities.FindRef(Enemy))
+		{
+			Enemy->GetAbilitySystemComponent()->GiveAbility(FGameplayAbilitySpec(Granted.Key, Granted.Value));
+		}
+	});
+	const FGrantResult Batched = MeasureGrant(Enemies, [](AAuraEnemy* Enemy)
+	{
+		UAuraAbilitySystemLibrary::GiveStartupAbilities(Enemy, Enemy->GetAbilitySystemComponent(),
+		                                                ICombatInterface::Execute_GetCharacterClass(Enemy));
+	});
+
+	TestEqual(TEXT("Both grants give the same abilities"), Batched.NumAbilities, PerAbility.NumAbilities);
+	TestEqual(TEXT("Both grants replicate the same specs"), Batched.SpecBits, PerAbility.SpecBits);
+	TestEqual(TEXT("The batched grant marks each ability list dirty once"), Batched.NumDirtyMarks, NumEnemies);
+
+	AuraTest::AddMeasurement(*this, FString::Printf(
+		TEXT("%d enemies, %d abilities, %.1f KB of spec properties to replicate: %.2f ms and %d dirty marks per ability, "
+			"%.2f ms and %d dirty marks batched"),
+		NumEnemies, Batched.NumAbilities, Batched.SpecBits / 8.0 / 1024.0, PerAbility.Seconds * 1000.0,
+		PerAbility.NumDirtyMarks, Batched.Seconds * 1000.0, Batched.NumDirtyMarks));
+	return true;
+}
+
+#endif
@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Character/AuraCharacter.h"
+#include "Character/AuraEnemy.h"
+#include "Tests/AuraTestWorld.h"
+
+namespace AuraTeamTest
+{
+	static const TCHAR* GameModeClassPath = TEXT("/Game/Blueprints/Game/BP_AuraGameMode.BP_AuraGameMode_C");
+
+	/** The check IsNotFriend made before teams, on the actor tags the character Blueprints set */
+	static bool IsNotFriendByTags(const AActor* FirstActor, const AActor* SecondActor)
+	{
+		const bool bBothArePlayers = FirstActor->ActorHasTag(FName("Player")) && SecondActor->ActorHasTag(FName("Player"));
+		const bool bBothAreEnemies = FirstActor->ActorHasTag(FName("Enemy")) && SecondActor->ActorHasTag(FName("Enemy"));
+		return !(bBothArePlayers || bBothAreEnemies);
+	}
+
+	static AAuraEnemy* SpawnEnemy(UWorld* World, AActor* Owner = nullptr)
+	{
+		AAuraEnemy* Enemy = World->SpawnActorDeferred<AAuraEnemy>(AAuraEnemy::StaticClass(), FTransform::Identity, Owner,
+		                                                          nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		Enemy->AutoPossessAI = EAutoPossessAI::Disabled;
+		Enemy->Tags.Add(FName("Enemy"));
+		Enemy->FinishSpawning(FTransform::Identity);
+		return Enemy;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraTeamTest, "Aura.Combat.IsNotFriendMatrix",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraTeamTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraTeamTest;
+
+	FAuraTestWorld TestWorld(GameModeClassPath);
+
+	AAuraCharacter* Player = TestWorld.Spawn<AAuraCharacter>();
+	Player->Tags.Add(FName("Player"));
+	AAuraCharacter* OtherPlayer = TestWorld.Spawn<AAuraCharacter>();
+	OtherPlayer->Tags.Add(FName("Player"));
+	AAuraEnemy* Enemy = SpawnEnemy(TestWorld.World);
+	AAuraEnemy* OtherEnemy = SpawnEnemy(TestWorld.World);
+	// Summoned minions are enemies spawned by, and owned by, their summoner
+	AAuraEnemy* Summon = SpawnEnemy(TestWorld.World, Enemy);
+	AActor* Neutral = TestWorld.Spawn<AActor>();
+
+	struct FEntry
+	{
+		const TCHAR* Name;
+		AActor* Actor;
+		EAuraTeam Team;
+	};
+	const FEntry Entries[] = {
+		{TEXT("Player"), Player, EAuraTeam::Player},
+		{TEXT("Other player"), OtherPlayer, EAuraTeam::Player},
+		{TEXT("Enemy"), Enemy, EAuraTeam::Enemy},
+		{TEXT("Other enemy"), OtherEnemy, EAuraTeam::Enemy},
+		{TEXT("Summon"), Summon, EAuraTeam::Enemy},
+		{TEXT("Neutral actor"), Neutral, EAuraTeam::None},
+	};
+
+	// Every ordered pair, an actor against itself included
+	for (const FEntry& First : Entries)
+	{
+		for (const FEntry& Second : Entries)
+		{
+			const bool bExpected = First.Team == EAuraTeam::None || First.Team != Second.Team;
+			const bool bNotFriend = UAuraAbilitySystemLibrary::IsNotFriend(First.Actor, Second.Actor);
+			if (bNotFriend != bExpected)
+			{
+				AddError(FString::Printf(TEXT("%s against %s: IsNotFriend gave %d, expected %d"),
+				                         First.Name, Second.Name, bNotFriend, bExpected));
+			}
+			if (bNotFriend != IsNotFriendByTags(First.Actor, Second.Actor))
+			{
+				AddError(FString::Printf(TEXT("%s against %s: IsNotFriend disagrees with the actor tags"),
+				                         First.Name, Second.Name));
+			}
+		}
+	}
+	return true;
+}
+
+#endif
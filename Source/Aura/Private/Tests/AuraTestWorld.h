@@ -0,0 +1,118 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Aura/AuraLogChannels.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Game/AuraGameInstance.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "Subsystems/WorldSubsystem.h"
+
+/**
+ * Transient game world for automation tests, torn down when it goes out of scope.
+ * Runs under its own UAuraGameInstance, with the game mode at GameModeClassPath when one is given.
+ */
+struct FAuraTestWorld
+{
+	explicit FAuraTestWorld(const TCHAR* GameModeClassPath = nullptr)
+	{
+		GameInstance = NewObject<UAuraGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone(TEXT("AuraTestWorld"));
+		World = GameInstance->GetWorld();
+
+		FURL URL;
+		if (GameModeClassPath)
+		{
+			URL.AddOption(*FString::Printf(TEXT("game=%s"), GameModeClassPath));
+		}
+		World->SetGameMode(URL);
+		World->InitializeActorsForPlay(URL);
+		World->BeginPlay();
+	}
+
+	~FAuraTestWorld()
+	{
+		GameInstance->Shutdown();
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		GameInstance->RemoveFromRoot();
+	}
+
+	/** Steps one engine frame: the world, then its tickable subsystems, which the engine ticks outside of the world */
+	void Tick(float DeltaSeconds = DefaultDeltaSeconds)
+	{
+		// Timers and async traces only move on once per engine frame
+		++GFrameCounter;
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+		for (UTickableWorldSubsystem* Subsystem : World->GetSubsystemArray<UTickableWorldSubsystem>())
+		{
+			if (Subsystem->IsTickable())
+			{
+				Subsystem->Tick(DeltaSeconds);
+			}
+		}
+	}
+
+	/** Game thread seconds taken by NumFrames calls to Tick */
+	double TickFrames(int32 NumFrames, float DeltaSeconds = DefaultDeltaSeconds)
+	{
+		double Seconds = 0.0;
+		{
+			FSimpleScopeSecondsCounter Counter(Seconds);
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				Tick(DeltaSeconds);
+			}
+		}
+		return Seconds;
+	}
+
+	template <typename T>
+	T* Spawn(UClass* Class = T::StaticClass(), const FTransform& Transform = FTransform::Identity)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<T>(Class, Transform, SpawnParams);
+	}
+
+	/** A player controller possessing a bare pawn at Location, local since the test world runs standalone */
+	APlayerController* SpawnLocalPlayer(const FVector& Location)
+	{
+		APawn* Pawn = Spawn<APawn>(APawn::StaticClass(), FTransform(Location));
+		APlayerController* PlayerController = Spawn<APlayerController>();
+		PlayerController->Possess(Pawn);
+		// Places the camera on the pawn now rather than with the next world tick
+		if (PlayerController->PlayerCameraManager)
+		{
+			PlayerController->PlayerCameraManager->UpdateCamera(0.f);
+		}
+		return PlayerController;
+	}
+
+	static constexpr float DefaultDeltaSeconds = 1.f / 60.f;
+
+	UAuraGameInstance* GameInstance = nullptr;
+	UWorld* World = nullptr;
+};
+
+namespace AuraTest
+{
+	/** Benchmark results go both to the log and to the automation report */
+	inline void AddMeasurement(FAutomationTestBase& Test, const FString& Message)
+	{
+		UE_LOG(LogAura, Display, TEXT("%s: %s"), *Test.GetTestName(), *Message);
+		Test.AddInfo(Message);
+	}
+}
+
+#endif
@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EngineUtils.h"
+#include "Aura/AuraLogChannels.h"
+#include "Checkpoint/MapEntrance.h"
+#include "Components/SphereComponent.h"
+#include "Engine/Engine.h"
+#include "Game/AuraGameInstance.h"
+#include "Game/AuraSaveGameStorage.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Tests/AutomationCommon.h"
+
+namespace AuraTravelTimingTest
+{
+	static const TCHAR* SlotName = TEXT("AuraTravelTimingTest");
+	static const TCHAR* StartMap = TEXT("/Game/Maps/Dungeon");
+	static constexpr double TimeoutSeconds = 60.0;
+
+	static UWorld* GetGameWorld()
+	{
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			if (WorldContext.WorldType == EWorldType::Game || WorldContext.WorldType == EWorldType::PIE)
+			{
+				return WorldContext.World();
+			}
+		}
+		return nullptr;
+	}
+
+	static UAuraGameInstance* GetAuraGameInstance()
+	{
+		const UWorld* World = GetGameWorld();
+		return World ? Cast<UAuraGameInstance>(World->GetGameInstance()) : nullptr;
+	}
+}
+
+/** Walks the local player into the first map entrance of the world to start a travel */
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAuraEnterMapEntranceCommand, FAutomationTestBase*, Test);
+
+bool FAuraEnterMapEntranceCommand::Update()
+{
+	using namespace AuraTravelTimingTest;
+
+	UWorld* World = GetGameWorld();
+	const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (!Pawn)
+	{
+		// Wait for the player to spawn
+		return false;
+	}
+
+	for (TActorIterator<AMapEntrance> It(World); It; ++It)
+	{
+		if (It->DestinationMap.IsNull()) continue;
+
+		const USphereComponent* Sphere = It->FindComponentByClass<USphereComponent>();
+		Pawn->SetActorLocation(Sphere ? Sphere->GetComponentLocation() : It->GetActorLocation(), false, nullptr,
+		                       ETeleportType::TeleportPhysics);
+		return true;
+	}
+
+	Test->AddError(FString::Printf(TEXT("%s has no map entrance with a destination"), StartMap));
+	return true;
+}
+
+/** Waits for the travel to reach a playable world and reports how long it took */
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FAuraWaitForTravelCommand, FAutomationTestBase*, Test, double, StartTime);
+
+bool FAuraWaitForTravelCommand::Update()
+{
+	using namespace AuraTravelTimingTest;
+
+	const UWorld* World = GetGameWorld();
+	const bool bTravelled = World && World->GetOutermost()->GetName() != StartMap;
+	const UAuraGameInstance* AuraGI = GetAuraGameInstance();
+	if (bTravelled && AuraGI && AuraGI->GetLastTravelSeconds() > 0.0)
+	{
+		UE_LOG(LogAura, Display, TEXT("Travel from map entrance to playable took %.1f ms"), AuraGI->GetLastTravelSeconds() * 1000.0);
+		Test->AddInfo(FString::Printf(TEXT("Travel took %.1f ms"), AuraGI->GetLastTravelSeconds() * 1000.0));
+		FAuraSaveGameStorage::DeleteGameInSlot(SlotName, 0);
+		return true;
+	}
+
+	if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
+	{
+		Test->AddError(TEXT("Travel did not reach a playable world in time"));
+		FAuraSaveGameStorage::DeleteGameInSlot(SlotName, 0);
+		return true;
+	}
+	return false;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraTravelTimingTest, "Aura.Travel.MapEntranceToPlayable",
+                                 EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FAuraTravelTimingTest::RunTest(const FString& Parameters)
+{
+	using namespace AuraTravelTimingTest;
+
+	if (UAuraGameInstance* AuraGI = GetAuraGameInstance())
+	{
+		// Play on a throwaway slot so the travel saves don't touch a real one
+		FAuraSaveGameStorage::DeleteGameInSlot(SlotName, 0);
+		AuraGI->LoadSlotName = SlotName;
+		AuraGI->LoadSlotIndex = 0;
+		AuraGI->InGameSaveGame = nullptr;
+	}
+
+	AutomationOpenMap(StartMap);
+	ADD_LATENT_AUTOMATION_COMMAND(FAuraEnterMapEntranceCommand(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FAuraWaitForTravelCommand(this, FPlatformTime::Seconds()));
+	return true;
+}
+
+#endif
@@ -54,6 +54,7 @@ void UMVVM_LoadScreen::NewSlotButtonPressed(int32 Slot, const FString& EnteredNa
 	UAuraGameInstance* AuraGameInstance = Cast<UAuraGameInstance>(AuraGameMode->GetGameInstance());
 	AuraGameInstance->LoadSlotName = LoadSlots[Slot]->GetSlotName();
 	AuraGameInstance->LoadSlotIndex = LoadSlots[Slot]->SlotIndex;
+	AuraGameInstance->InGameSaveGame = nullptr;
 	AuraGameInstance->PlayerStartTag = AuraGameMode->DefaultPlayerStartTag;
 }
 
@@ -98,6 +99,7 @@ void UMVVM_LoadScreen::PlayButtonPressed()
 	AuraGameInstance->PlayerStartTag = SelectedSlot->PlayerStartTag;
 	AuraGameInstance->LoadSlotName = SelectedSlot->GetSlotName();
 	AuraGameInstance->LoadSlotIndex = SelectedSlot->SlotIndex;
+	AuraGameInstance->InGameSaveGame = nullptr;
 
 	if (IsValid(SelectedSlot))
 	{
@@ -42,6 +42,9 @@ public:
 	void AddCharacterPassiveAbilities(const TArray<TSubclassOf<UGameplayAbility>>& StartupPassiveAbilities);
 	bool bStartupAbilitiesGiven = false;
 
+	/** Grants all Specs in one pass, marking the ability list dirty once instead of once per ability */
+	void GiveAbilities(TArrayView<FGameplayAbilitySpec> Specs);
+
 	void AbilityInputTagPressed(const FGameplayTag& InputTag);
 	void AbilityInputTagHeld(const FGameplayTag& InputTag);
 	void AbilityInputTagReleased(const FGameplayTag& InputTag);
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AttributeSet.h"
 #include "ScalableFloat.h"
 #include "Engine/DataAsset.h"
 #include "CharacterClassInfo.generated.h"
@@ -33,6 +34,15 @@ struct FCharacterClassDefaultInfo
 	FScalableFloat XPReward = FScalableFloat();
 };
 
+/** Attribute base values a character of one class and level ends up with after its default attribute effects */
+struct FAuraAttributeSnapshot
+{
+	TArray<TPair<FGameplayAttribute, float>> BaseValues;
+
+	/** False when the default effects leave active effects behind, characters then always get the effects themselves */
+	bool bCacheable = true;
+};
+
 /**
  * 
  */
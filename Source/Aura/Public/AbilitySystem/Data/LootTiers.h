@@ -24,6 +24,19 @@ struct FLootItem
 	bool bLootLevelOverride = true;
 };
 
+/**
+ * Alias table over how many copies of one loot item a roll yields (0 to MaxNumberToSpawn),
+ * so the item costs a single draw no matter how many copies it can drop.
+ */
+struct FLootCountTable
+{
+	TArray<float> Probability;
+	TArray<int32> Alias;
+
+	void Build(int32 MaxCount, double CopyChance);
+	int32 Sample(FRandomStream& Stream) const;
+};
+
 /**
  * 
  */
@@ -36,6 +49,20 @@ public:
 	UFUNCTION(BlueprintCallable)
 	TArray<FLootItem> GetLootItems();
 
+	/** Rolls every loot item with Stream into OutItems, which is reset but keeps its allocation */
+	void RollLoot(FRandomStream& Stream, TArray<FLootItem>& OutItems);
+
 	UPROPERTY(EditDefaultsOnly, Category = "LootTiers|Spawning")
 	TArray<FLootItem> LootItems;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** One per entry of LootItems */
+	TArray<FLootCountTable> CountTables;
+
+	void BuildCountTables();
 };
@@ -1,4 +1,4 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
+// Fill out your copyright notice in the Description page of Project Settings.
 
 
 #pragma once
@@ -9,7 +9,8 @@
 #include "DebuffNiagaraComponent.generated.h"
 
 /**
- * 
+ * Debuff effect component of character blueprints saved before AAuraCharacterBase::StatusEffectSystems.
+ * Characters no longer create it, the class only stays so those blueprints still load until they are resaved.
  */
 UCLASS()
 class AURA_API UDebuffNiagaraComponent : public UNiagaraComponent
@@ -20,8 +21,4 @@ public:
 
 	UPROPERTY(VisibleAnywhere)
 	FGameplayTag DebuffTag;
-
-protected:
-	virtual void BeginPlay() override;
-	void DebuffTagChanged(const FGameplayTag CallbackTag, int32 NewCount);
 };
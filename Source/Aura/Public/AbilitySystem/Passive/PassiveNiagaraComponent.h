@@ -7,9 +7,9 @@
 #include "GameplayTagContainer.h"
 #include "PassiveNiagaraComponent.generated.h"
 
-class UAuraAbilitySystemComponent;
 /**
- * 
+ * Passive spell effect component of character blueprints saved before AAuraCharacterBase::StatusEffectSystems.
+ * Characters no longer create it, the class only stays so those blueprints still load until they are resaved.
  */
 UCLASS()
 class AURA_API UPassiveNiagaraComponent : public UNiagaraComponent
@@ -20,9 +20,4 @@ public:
 
 	UPROPERTY(EditDefaultsOnly)
 	FGameplayTag PassiveSpellTag;
-
-protected:
-	virtual void BeginPlay() override;
-	void OnPassiveActivate(const FGameplayTag& AbilityTag, bool bActivate);
-	void ActivateIfEquipped(UAuraAbilitySystemComponent* AuraASC);
 };
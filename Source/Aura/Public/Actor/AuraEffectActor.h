@@ -34,6 +34,14 @@ public:
 	AAuraEffectActor();
 	virtual void Tick(float DeltaTime) override;
 
+	/** Set by the pickup pool, the actor then goes back to it instead of being destroyed once used */
+	bool bReturnToPool = false;
+
+	void ActivateFromPool(const FTransform& Transform);
+	void DeactivateForPool();
+
+	void SetActorLevel(float InActorLevel) { ActorLevel = InActorLevel; }
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -67,6 +75,30 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup Movement")
 	FVector InitialLocation;
 
+	/**
+	 * Meshes whose material reads these from custom primitive data bob and spin in world position offset,
+	 * driven by the material's time, and the actor doesn't tick at all.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup Movement")
+	FName BobAmplitudeParameterName = FName("BobAmplitude");
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup Movement")
+	FName BobFrequencyParameterName = FName("BobFrequency");
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup Movement")
+	FName SpinRateParameterName = FName("SpinRate");
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup Movement")
+	FName MovementStartTimeParameterName = FName("MovementStartTime");
+
+	/** Pickups without such a material move on the CPU, ticking only within this distance of a local camera */
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup Movement")
+	float MovementTickDistance = 3000.f;
+
+	/** Called when the pickup pool hands this actor out again, to restart any spawn animation */
+	UFUNCTION(BlueprintImplementableEvent)
+	void OnActivatedFromPool();
+
 	UFUNCTION(BlueprintCallable)
 	void ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGameplayEffect> GameplayEffectClass);
 
@@ -103,13 +135,23 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Applied Effects")
 	EEffectRemovalPolicy InfiniteEffectRemovalPolicy = EEffectRemovalPolicy::RemoveOnEndOverlap;
 
-	TMap<FActiveGameplayEffectHandle, UAbilitySystemComponent*> ActiveEffectHandles;
+	/** Infinite effects to remove on end overlap, per target */
+	TMap<TObjectKey<UAbilitySystemComponent>, TArray<FActiveGameplayEffectHandle, TInlineAllocator<2>>>
+	ActiveEffectHandles;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Applied Effects")
 	float ActorLevel = 1.f;
 
 private:
 	float RunningTime = 0.f;
+	float SinePeriod = 2 * PI;
+
+	FTimerHandle MovementTickTimer;
 
 	void ItemMovement(float DeltaTime);
+	void UpdateMovement();
+	bool PushMovementToMaterials();
+	void UpdateMovementTick();
+	void DestroyOrReturnToPool();
+	bool IsIgnoredTarget(const AActor* TargetActor) const;
 };
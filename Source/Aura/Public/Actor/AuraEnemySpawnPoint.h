@@ -20,8 +20,9 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SpawnEnemy();
 
+	/** Soft so the volume can stream it in ahead of the wave, loaded on the spot if that hasn't finished */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Class")
-	TSubclassOf<AAuraEnemy> EnemyClass;
+	TSoftClassPtr<AAuraEnemy> EnemyClass;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enemy Class")
 	int32 EnemyLevel = 1;
@@ -8,7 +8,9 @@
 #include "AuraEnemySpawnVolume.generated.h"
 
 class UBoxComponent;
+class USphereComponent;
 class AAuraEnemySpawnPoint;
+struct FStreamableHandle;
 
 UCLASS()
 class AURA_API AAuraEnemySpawnVolume : public AActor, public ISaveInterface
@@ -31,11 +33,24 @@ protected:
 	UFUNCTION()
 	virtual void OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+	/** Starts streaming in the enemy classes (and with them their behavior trees) before the player reaches the box */
+	UFUNCTION()
+	virtual void OnPreloadOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
 	UPROPERTY(EditAnywhere)
 	TArray<AAuraEnemySpawnPoint*> SpawnPoints;
+
+	/** How far outside the box the player is when the enemy classes start loading */
+	UPROPERTY(EditAnywhere)
+	float PreloadDistance = 1500.f;
 private:
 
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<UBoxComponent> Box;
 
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<USphereComponent> PreloadSphere;
+
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
 };
@@ -8,6 +8,7 @@
 #include "GameFramework/Actor.h"
 #include "AuraProjectile.generated.h"
 
+class UAbilitySystemComponent;
 class UNiagaraSystem;
 class USphereComponent;
 class UProjectileMovementComponent;
@@ -29,6 +30,27 @@ public:
 	UPROPERTY()
 	TObjectPtr<USceneComponent> HomingTargetSceneComponent;
 
+	/**
+	 * Projectile spells launch this class through UAuraProjectileSubsystem instead of spawning the actor,
+	 * only the speed, sphere radius, life span and impact effects of these defaults are used then.
+	 * Homing and Blueprint logic are not supported in that mode.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Lightweight")
+	bool bLightweight = false;
+
+	/** Follows a lightweight projectile in place of the actor's own components */
+	UPROPERTY(EditDefaultsOnly, Category = "Lightweight")
+	TObjectPtr<UNiagaraSystem> LightweightTrailEffect;
+
+	float GetCollisionRadius() const;
+	float GetProjectileLifeSpan() const { return LifeSpan; }
+	UNiagaraSystem* GetImpactEffect() const { return ImpactEffect; }
+	USoundBase* GetImpactSound() const { return ImpactSound; }
+
+	/** Fills in the death impulse and knockback along Rotation and applies the damage to TargetASC */
+	static void ApplyProjectileDamage(FDamageEffectParams& DamageEffectParams, UAbilitySystemComponent* TargetASC,
+	                                  const FRotator& Rotation, bool bKnockback);
+
 protected:
 	virtual void BeginPlay() override;
 
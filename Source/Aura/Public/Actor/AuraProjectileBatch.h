@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Game/AuraProjectileSubsystem.h"
+#include "AuraProjectileBatch.generated.h"
+
+/**
+ * Always relevant actor the server spawns once per world to tell clients about lightweight projectiles.
+ * Only launches and hits are sent, clients simulate the flight in their own UAuraProjectileSubsystem.
+ */
+UCLASS(NotBlueprintable)
+class AURA_API AAuraProjectileBatch : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AAuraProjectileBatch();
+
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastLaunch(const FAuraProjectileLaunch& Launch);
+
+	/** Unreliable, clients that miss it still end the projectile on their own hit or at the end of its life span */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastHit(uint32 Id, FVector_NetQuantize Location);
+};
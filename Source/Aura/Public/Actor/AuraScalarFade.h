@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UPrimitiveComponent;
+
+/**
+ * Fades like the death dissolve, driven per primitive through custom primitive data instead of a material instance dynamic.
+ * The fade is written once as a vector parameter (start time, from, to, duration) and the material evaluates
+ * Lerp(From, To, Saturate((Time - StartTime) / Duration)) itself, so nothing runs on the game thread while it plays.
+ * StartTime is world time, which is what the material Time node reads.
+ */
+struct FAuraScalarFade
+{
+	/** Custom primitive data index Material reads the scalar ParameterName from, INDEX_NONE if it is a regular parameter */
+	static int32 FindCustomDataIndex(const UMaterialInterface* Material, FName ParameterName);
+
+	/** Custom primitive data index of the fade vector ParameterName, INDEX_NONE if Material doesn't read it from there */
+	static int32 FindFadeDataIndex(const UMaterialInterface* Material, FName ParameterName);
+
+	/** Fallback for materials that don't read the fade from custom primitive data */
+	static UMaterialInstanceDynamic* CreateFallbackMID(UPrimitiveComponent* Primitive, UMaterialInterface* Material,
+	                                                   UObject* Outer);
+
+	/** Starts the fade on Primitive, the only write it ever needs */
+	static void Start(UPrimitiveComponent* Primitive, int32 DataIndex, float From, float To, float Duration, double StartTime);
+};
@@ -4,13 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystemInterface.h"
+#include "GenericTeamAgentInterface.h"
 #include "GameFramework/Character.h"
 #include "AbilitySystem/Data/CharacterClassInfo.h"
 #include "Interaction/CombatInterface.h"
 #include "AuraCharacterBase.generated.h"
 
-class UPassiveNiagaraComponent;
-class UDebuffNiagaraComponent;
+class UNiagaraComponent;
 class UNiagaraSystem;
 class UAbilitySystemComponent;
 class UAttributeSet;
@@ -18,14 +18,14 @@ class UGameplayEffect;
 class UGameplayAbility;
 class UAnimMontage;
 
-UCLASS(Abstract)
-class AURA_API AAuraCharacterBase : public ACharacter, public IAbilitySystemInterface, public ICombatInterface
+UCLASS(Abstract, Config=Game)
+class AURA_API AAuraCharacterBase : public ACharacter, public IAbilitySystemInterface, public ICombatInterface,
+                                     public IGenericTeamAgentInterface
 {
 	GENERATED_BODY()
 
 public:
 	AAuraCharacterBase();
-	virtual void Tick(float DeltaTime) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const;
 	virtual float TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInstigator,
 	                         AActor* DamageCauser) override;
@@ -53,6 +53,10 @@ public:
 	virtual FOnDamageSignature& GetOnDamageSignature() override;
 	/** end Combat Interface */
 
+	/** Generic Team Agent Interface */
+	virtual FGenericTeamId GetGenericTeamId() const override;
+	/** end Generic Team Agent Interface */
+
 	FOnASCRegistered OnAscRegistered;
 	FOnDeathSignature OnDeathDelegate;
 	FOnDamageSignature OnDamageDelegate;
@@ -60,6 +64,12 @@ public:
 	UFUNCTION(NetMulticast, Reliable)
 	virtual void MulticastHandleDeath(const FVector& DeathImpulse);
 
+	/** Stops simulating the ragdoll, keeping the pose it is in */
+	void FreezeRagdoll();
+
+	/** Gets rid of the dead character before its life span is up, called on the server when over the corpse budget */
+	virtual void RemoveCorpse();
+
 	UPROPERTY(EditAnywhere, Category = "Combat")
 	TArray<FTaggedMontage> AttackMontages;
 
@@ -79,9 +89,11 @@ public:
 	virtual void OnRep_Burned();
 
 	void SetCharacterClass(ECharacterClass InClass) { CharacterClass = InClass; }
+	EAuraTeam GetTeam() const { return Team; }
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
 	TObjectPtr<USkeletalMeshComponent> Weapon;
@@ -132,6 +144,9 @@ protected:
 
 	void Dissolve();
 
+	/** Undoes the local side of MulticastHandleDeath so the character can be used again */
+	void ResetRagdoll();
+
 	UFUNCTION(BlueprintImplementableEvent)
 	void StartDissolveTimeline(UMaterialInstanceDynamic* DynamicMaterialInstance);
 
@@ -144,6 +159,23 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	TObjectPtr<UMaterialInstance> WeaponDissolveMaterialInstance;
 
+	/**
+	 * Fade vector (start time, from, to, duration) a dissolve material reads from custom primitive data, see FAuraScalarFade.
+	 * The material then dissolves from DissolveStartValue to DissolveEndValue with no MID. Otherwise a MID is handed
+	 * to the dissolve timeline.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Dissolve")
+	FName DissolveParameterName = FName("DissolveFade");
+
+	UPROPERTY(EditDefaultsOnly, Category = "Dissolve")
+	float DissolveStartValue = -0.1f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Dissolve")
+	float DissolveEndValue = 0.55f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Dissolve")
+	float DissolveDuration = 3.f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
 	UNiagaraSystem* BloodEffect;
 
@@ -157,11 +189,23 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character Class Defaults")
 	ECharacterClass CharacterClass = ECharacterClass::Warrior;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UDebuffNiagaraComponent> BurnDebuffComponent;
+	/** Set by the player and enemy constructors */
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Combat")
+	EAuraTeam Team = EAuraTeam::None;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UDebuffNiagaraComponent> StunDebuffComponent;
+	/* Status Effects */
+
+	/**
+	 * Looping effect shown while a debuff tag is on the character or a passive ability tag is equipped.
+	 * Spawned from the Niagara pool when the status starts and handed back when it ends.
+	 * Defaults per class come from the game config, a blueprint can still override them.
+	 */
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Effects")
+	TMap<FGameplayTag, TObjectPtr<UNiagaraSystem>> StatusEffectSystems;
+
+	void BindStatusEffects(UAbilitySystemComponent* ASC);
+	void SetStatusEffectActive(const FGameplayTag& StatusTag, bool bActive);
+	void ReleaseStatusEffects();
 
 private:
 	UPROPERTY(EditAnywhere, Category = "Abilities")
@@ -174,14 +218,13 @@ private:
 	TObjectPtr<UAnimMontage> HitReactMontage;
 
 	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UPassiveNiagaraComponent> HaloOfProtectionNiagaraComponent;
+	TObjectPtr<USceneComponent> EffectAttachComponent;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UPassiveNiagaraComponent> LifeSiphonNiagaraComponent;
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, TObjectPtr<UNiagaraComponent>> ActiveStatusEffects;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<UPassiveNiagaraComponent> ManaSiphonNiagaraComponent;
+	TWeakObjectPtr<UAbilitySystemComponent> StatusEffectASC;
 
-	UPROPERTY(VisibleAnywhere)
-	TObjectPtr<USceneComponent> EffectAttachComponent;
+	void StatusTagChanged(const FGameplayTag CallbackTag, int32 NewCount);
+	void OnPassiveActivate(const FGameplayTag& AbilityTag, bool bActivate);
 };
@@ -61,6 +61,19 @@ public:
 
 	void SetLevel(int32 InLevel) { Level = InLevel; }
 
+	/* Pooling */
+
+	/** Set for enemies handed out by UAuraEnemyPoolSubsystem, they go back to it after dying instead of being destroyed */
+	bool bReturnToPool = false;
+
+	virtual void RemoveCorpse() override;
+
+	/** Server only. Resets abilities, effects and attributes for the new level and class and restarts the AI */
+	void ReviveFromPool(const FTransform& Transform, int32 InLevel, ECharacterClass InCharacterClass);
+
+	/** Server only. Hides the corpse and stops its AI while it waits in the pool */
+	void DeactivateForPool();
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void InitAbilityActorInfo() override;
@@ -79,6 +92,19 @@ protected:
 	UPROPERTY()
 	TObjectPtr<AAuraAIController> AuraAIController;
 
-	UFUNCTION(BlueprintImplementableEvent)
+	/** No longer called, loot drops through the pickup pool in DropLoot. Kept so Blueprints overriding it still compile */
+	UFUNCTION(BlueprintImplementableEvent, meta = (DeprecatedFunction, DeprecationMessage = "Loot is dropped from the pickup pool, remove this override"))
 	void SpawnLoot();
+
+private:
+	void StartBehaviorTree();
+
+	/** Drops the loot tiers' pickups from the pickup pool */
+	void DropLoot();
+
+	void ReturnToPool();
+	FTimerHandle PoolReturnTimer;
+
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastReviveFromPool();
 };
@@ -52,12 +52,29 @@ protected:
 	UPROPERTY(EditDefaultsOnly)
 	int32 CustomDepthStencilOverride = CUSTOM_DEPTH_TAN;
 
+	/** DynamicMaterialInstance is null when the glow runs from custom primitive data, and on a dedicated server */
 	UFUNCTION(BlueprintImplementableEvent)
 	void CheckpointReached(UMaterialInstanceDynamic* DynamicMaterialInstance);
 
 	UFUNCTION(BlueprintCallable)
 	void HandleGlowEffects();
 
+	/**
+	 * Fade vector (start time, from, to, duration) the checkpoint material reads from custom primitive data, see FAuraScalarFade.
+	 * When the material doesn't read it from there, CheckpointReached gets a MID to animate instead.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Glow")
+	FName GlowParameterName = FName("GlowFade");
+
+	UPROPERTY(EditDefaultsOnly, Category = "Glow")
+	float GlowStartValue = 0.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Glow")
+	float GlowEndValue = 1.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Glow")
+	float GlowDuration = 1.f;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<UStaticMeshComponent> CheckpointMesh;
 
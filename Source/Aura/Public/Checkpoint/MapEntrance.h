@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Checkpoint/Checkpoint.h"
+#include "Engine/EngineBaseTypes.h"
 #include "MapEntrance.generated.h"
 
 /**
@@ -32,7 +33,19 @@ public:
 	FName DestinationPlayerStartTag;
 
 protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	                             UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
 	                             const FHitResult& SweepResult) override;
+
+private:
+	void OnDestinationMapLoaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+	void OnTravelFailure(UWorld* World, ETravelFailure::Type FailureType, const FString& ErrorString);
+
+	/** Lets the entrance start another travel when this one fails */
+	void ResetTravel();
+
+	bool bTravelPending = false;
+	FDelegateHandle TravelFailureHandle;
 };
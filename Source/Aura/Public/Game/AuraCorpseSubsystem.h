@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraCorpseSubsystem.generated.h"
+
+class AAuraCharacterBase;
+
+/**
+ * Keeps the number of simulating ragdolls and lingering corpses bounded.
+ * Past MaxSimultaneousRagdolls the oldest (or farthest from every player's view) ragdoll is frozen in its current pose,
+ * and past MaxCorpses the server removes the oldest enemy corpses (back to the enemy pool when they came from it)
+ * before their life span runs out.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraCorpseSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Call once the character's mesh has started simulating */
+	void RegisterRagdoll(AAuraCharacterBase* Character);
+
+	void UnregisterCorpse(AAuraCharacterBase* Character);
+
+	virtual void Deinitialize() override;
+
+private:
+	UPROPERTY(Config)
+	int32 MaxSimultaneousRagdolls = 12;
+
+	/** Ragdolls are frozen after simulating this long even when under budget */
+	UPROPERTY(Config)
+	float MaxRagdollTime = 4.f;
+
+	UPROPERTY(Config)
+	int32 MaxCorpses = 40;
+
+	/** Freeze the ragdoll farthest from its nearest player view first instead of the oldest one */
+	UPROPERTY(Config)
+	bool bFreezeFarthestFirst = true;
+
+	struct FCorpse
+	{
+		TWeakObjectPtr<AAuraCharacterBase> Character;
+		double DeathTime = 0.0;
+		bool bSimulating = true;
+	};
+	/** Oldest first */
+	TArray<FCorpse> Corpses;
+	int32 NumSimulating = 0;
+
+	FTimerHandle UpdateTimer;
+
+	void Update();
+	void FreezeOverBudget();
+	void RemoveOverBudget();
+	void Freeze(FCorpse& Corpse);
+	int32 GetRagdollBudget() const;
+};
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEffectsSubsystem.generated.h"
+
+class UNiagaraComponent;
+class UNiagaraSystem;
+class USoundBase;
+
+/**
+ * Spawns the fire-and-forget cosmetics of the game (impacts, click markers, death sounds).
+ * Niagara systems come from the world's AutoRelease component pool, capped per system,
+ * and everything farther than CullDistance from every local player's camera is skipped.
+ * Not created on dedicated servers, where the static helpers do nothing.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraEffectsSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UNiagaraComponent* SpawnSystemAtLocation(const UObject* WorldContextObject, UNiagaraSystem* System,
+	                                                const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+	static void PlaySoundAtLocation(const UObject* WorldContextObject, USoundBase* Sound, const FVector& Location,
+	                                const FRotator& Rotation = FRotator::ZeroRotator);
+
+	/** True when a local player's camera is within Distance of Location, always false on a dedicated server */
+	static bool IsNearLocalPlayer(const UWorld* World, const FVector& Location, float Distance);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Effects farther than this from every local camera are not spawned */
+	UPROPERTY(Config)
+	float CullDistance = 6000.f;
+
+	/** Active instances allowed per Niagara system when it has no entry in MaxActivePerSystem */
+	UPROPERTY(Config)
+	int32 DefaultMaxActivePerSystem = 8;
+
+	UPROPERTY(Config)
+	TMap<TSoftObjectPtr<UNiagaraSystem>, int32> MaxActivePerSystem;
+
+	TMap<TObjectKey<UNiagaraSystem>, TArray<TWeakObjectPtr<UNiagaraComponent>>> ActiveComponents;
+
+	UNiagaraComponent* SpawnSystem(UNiagaraSystem* System, const FVector& Location, const FRotator& Rotation);
+	bool IsNearLocalPlayer(const FVector& Location) const;
+	int32 GetMaxActive(const UNiagaraSystem* System) const;
+};
@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/Data/CharacterClassInfo.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraEnemyPoolSubsystem.generated.h"
+
+class AAuraEnemy;
+
+USTRUCT()
+struct FPooledEnemies
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraEnemy>> Enemies;
+};
+
+/**
+ * Server side pool of dead enemies, keyed by enemy class.
+ * A released enemy keeps its ASC, attribute set, AI controller and widgets and is hidden until
+ * AcquireEnemy revives it somewhere else, which skips the spawn, component and controller creation.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Revives a pooled enemy of EnemyClass or spawns a new one when there is none */
+	AAuraEnemy* AcquireEnemy(TSubclassOf<AAuraEnemy> EnemyClass, const FTransform& Transform, int32 Level,
+	                         ECharacterClass CharacterClass);
+
+	/** Takes a dead enemy back, destroying it instead when its class already has MaxPooledPerClass enemies waiting */
+	void ReleaseEnemy(AAuraEnemy* Enemy);
+
+private:
+	UPROPERTY(Config)
+	int32 MaxPooledPerClass = 16;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AAuraEnemy>, FPooledEnemies> FreeEnemies;
+};
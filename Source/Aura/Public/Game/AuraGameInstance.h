@@ -6,6 +6,8 @@
 #include "Engine/GameInstance.h"
 #include "AuraGameInstance.generated.h"
 
+class ULoadScreenSaveGame;
+
 /**
  * 
  */
@@ -23,4 +25,27 @@ public:
 
 	UPROPERTY()
 	int32 LoadSlotIndex = 0;
+
+	/** Save game of the slot being played, handed across level travel so it isn't read back from disk. Cleared when the slot changes */
+	UPROPERTY()
+	TObjectPtr<ULoadScreenSaveGame> InGameSaveGame;
+
+	/** Destination world loaded ahead of travel, referenced here so it survives the garbage collection of the old world */
+	UPROPERTY()
+	TObjectPtr<UWorld> PreloadedMap;
+
+	void BeginTravel();
+	void EndTravel();
+
+	/** Drops the preloaded map when the travel started by BeginTravel never happens */
+	void CancelTravel();
+
+	/** Seconds the last travel took from map entrance to playable, 0 until a travel has finished */
+	double GetLastTravelSeconds() const { return LastTravelSeconds; }
+
+	virtual void Shutdown() override;
+
+private:
+	double TravelStartTime = 0.0;
+	double LastTravelSeconds = 0.0;
 };
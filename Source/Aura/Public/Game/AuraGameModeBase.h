@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameModeBase.h"
+#include "AbilitySystem/Data/CharacterClassInfo.h"
+#include "Game/LoadScreenSaveGame.h"
 #include "AuraGameModeBase.generated.h"
 
 class ULootTiers;
@@ -11,7 +13,6 @@ class ULoadScreenSaveGame;
 class USaveGame;
 class UMVVM_LoadSlot;
 class UAbilityInfo;
-class UCharacterClassInfo;
 
 /**
  * 
@@ -25,6 +26,9 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="Character Class Defaults")
 	TObjectPtr<UCharacterClassInfo> CharacterClassInfo;
 
+	/** Result of the default attribute effects per class and level, filled by the first character of each */
+	TMap<TPair<ECharacterClass, int32>, FAuraAttributeSnapshot> AttributeSnapshots;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Ability Info")
 	TObjectPtr<UAbilityInfo> AbilityInfo;
 
@@ -37,11 +41,18 @@ public:
 	
 	static void DeleteSlot(const FString& SlotName, int32 SlotIndex);
 	
-	ULoadScreenSaveGame* RetrieveInGameSaveData();
+	ULoadScreenSaveGame* RetrieveInGameSaveData() const;
+
+	/** Copy of the in-game save to edit, the cached one only changes once the copy goes to SaveInGameProgressData */
+	ULoadScreenSaveGame* CopyInGameSaveData() const;
 	
 	void SaveInGameProgressData(ULoadScreenSaveGame* SaveObject);
 
-	void SaveWorldState(UWorld* World, const FString& DestinationMapAssetName = FString("")) const;
+	/**
+	 * Stores the SaveGame variables of the world's actors in the in-game save.
+	 * Pass bWriteToSlot false when SaveInGameProgressData follows, so the save is only serialized once.
+	 */
+	void SaveWorldState(UWorld* World, const FString& DestinationMapAssetName = FString(""), bool bWriteToSlot = true) const;
 	void LoadWorldState(UWorld* World) const;
 
 	void TravelToMap(UMVVM_LoadSlot* Slot);
@@ -49,6 +60,10 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Save Game")
 	TSubclassOf<USaveGame> LoadScreenSaveGameClass;
 
+	/** Codec applied to the actor bytes of every saved map */
+	UPROPERTY(EditDefaultsOnly, Category = "Save Game")
+	ESaveCompression SaveCompression = ESaveCompression::Oodle;
+
 	UPROPERTY(EditDefaultsOnly)
 	FString DefaultMapName;
 
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystem/Data/LootTiers.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraPickupPoolSubsystem.generated.h"
+
+class AAuraEffectActor;
+
+USTRUCT()
+struct FPooledPickups
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraEffectActor>> Pickups;
+};
+
+/**
+ * Server side pool of loot pickups, keyed by pickup class.
+ * Effect actor pickups go back to the pool when picked up instead of being destroyed;
+ * loot classes that are not effect actors are spawned and left alone as before.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraPickupPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Rolls LootTiers with Stream and places the pickups evenly around Location, facing away from it */
+	void DropLoot(ULootTiers* LootTiers, FRandomStream& Stream, const FVector& Location, const FVector& Forward,
+	              float Level);
+
+	AActor* AcquirePickup(TSubclassOf<AActor> PickupClass, const FTransform& Transform);
+
+	/** Takes a used pickup back, destroying it instead when its class already has MaxPooledPerClass pickups waiting */
+	void ReleasePickup(AAuraEffectActor* Pickup);
+
+private:
+	UPROPERTY(Config)
+	int32 MaxPooledPerClass = 32;
+
+	/** Distance from the drop location the pickups are placed at */
+	UPROPERTY(Config)
+	float DropRadius = 50.f;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AAuraEffectActor>, FPooledPickups> FreePickups;
+
+	/** Reused by every DropLoot */
+	TArray<FLootItem> LootBuffer;
+};
@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AuraAbilityTypes.h"
+#include "Engine/NetSerialization.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "AuraProjectileSubsystem.generated.h"
+
+class AAuraProjectile;
+class AAuraProjectileBatch;
+class UNiagaraComponent;
+
+/** Everything a client needs to simulate a lightweight projectile on its own */
+USTRUCT()
+struct FAuraProjectileLaunch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 Id = 0;
+
+	/** Defaults of this class give the radius, life span and effects */
+	UPROPERTY()
+	TSubclassOf<AAuraProjectile> ProjectileClass;
+
+	UPROPERTY()
+	FVector_NetQuantize Origin;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction;
+
+	UPROPERTY()
+	float Speed = 0.f;
+
+	/** Seeds the server's knockback roll for this projectile */
+	UPROPERTY()
+	int32 Seed = 0;
+
+	/** Ignored by the sweeps */
+	UPROPERTY()
+	TObjectPtr<AActor> SourceActor;
+};
+
+/**
+ * Simulates projectiles whose class has bLightweight set as plain arrays instead of actors.
+ * Every frame all of them move and issue their sweeps as async traces, which are resolved the frame after.
+ * The server applies the damage; clients only get the launch and the hit through AAuraProjectileBatch
+ * and run the same simulation for the visuals.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Server only */
+	void LaunchProjectile(TSubclassOf<AAuraProjectile> ProjectileClass, const FVector& Origin, const FVector& Direction,
+	                      AActor* SourceActor, const FDamageEffectParams& DamageEffectParams);
+
+	/** DamageEffectParams is only used on the server */
+	void AddProjectile(const FAuraProjectileLaunch& Launch, const FDamageEffectParams& DamageEffectParams);
+
+	/** Ends the projectile with its impact effects at Location, if it is still flying */
+	void EndProjectile(uint32 Id, const FVector& Location);
+
+	int32 GetNumProjectiles() const { return Ids.Num(); }
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !Ids.IsEmpty() || !PendingHits.IsEmpty(); }
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Launches past this many live projectiles are dropped */
+	UPROPERTY(Config)
+	int32 MaxProjectiles = 4096;
+
+	/* One entry per live projectile in each array, kept in step by RemoveProjectileAt */
+
+	TArray<uint32> Ids;
+	TArray<FVector> Locations;
+	TArray<FVector> Velocities;
+	TArray<float> Radii;
+	TArray<double> EndTimes;
+	TArray<int32> Seeds;
+	TArray<TWeakObjectPtr<AActor>> SourceActors;
+	TArray<TWeakObjectPtr<UNiagaraComponent>> Trails;
+
+	UPROPERTY()
+	TArray<TSubclassOf<AAuraProjectile>> ProjectileClasses;
+
+	UPROPERTY()
+	TArray<FDamageEffectParams> DamageParams;
+
+	TMap<uint32, int32> IdToIndex;
+	uint32 NextId = 1;
+
+	struct FPendingHit
+	{
+		uint32 Id = 0;
+		TArray<FHitResult> Hits;
+	};
+	TArray<FPendingHit> PendingHits;
+
+	FTraceDelegate SweepDelegate;
+
+	UPROPERTY()
+	TObjectPtr<AAuraProjectileBatch> Batch;
+
+	void OnSweepComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void ResolveHits();
+	bool IsValidHit(int32 Index, AActor* HitActor) const;
+	void ApplyHit(int32 Index, AActor* HitActor);
+	void PlayImpact(int32 Index, const FVector& Location);
+	void RemoveProjectileAt(int32 Index);
+};
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AuraRandomSubsystem.generated.h"
+
+/**
+ * Source of every gameplay random roll in a world.
+ * Each source (usually the actor a roll is made for) draws from its own substream seeded from the world seed and
+ * the source's name, so the outcome of a fight doesn't depend on how other fights interleave with it.
+ * Streams are kept per source object and dropped when the source actor is destroyed.
+ * With a fixed Seed (or Aura.Random.Seed) the same fight replays with the same blocks, crits, debuffs and drops.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Stream for rolls made on behalf of Source.
+	 * The reference is only valid until the next GetStream call, draw from it right away.
+	 */
+	static FRandomStream& GetStream(const UObject* WorldContextObject, const UObject* Source);
+
+	/** Seed of the stream for a source named SourceName, the same in every process and on every platform */
+	static int32 MakeStreamSeed(int32 WorldSeed, const FString& SourceName);
+
+	int32 GetWorldSeed() const { return WorldSeed; }
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+private:
+	/** 0 picks a new seed every time the world starts */
+	UPROPERTY(Config)
+	int32 Seed = 0;
+
+	int32 WorldSeed = 0;
+
+	TMap<TObjectKey<UObject>, FRandomStream> Streams;
+
+	FDelegateHandle ActorDestroyedHandle;
+
+	void OnActorDestroyed(AActor* Actor);
+};
@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+enum class ESaveCompression : uint8;
+struct FSavedActor;
+struct FSavedMap;
+
+/**
+ * Proxy archive used to serialize the SaveGame variables of an actor.
+ * FNames are written as an index into NameTable instead of a full string,
+ * so a name repeated across properties and actors is only stored once.
+ */
+struct FAuraSaveGameArchive : public FObjectAndNameAsStringProxyArchive
+{
+	FAuraSaveGameArchive(FArchive& InInnerArchive, TArray<FName>& InNameTable);
+
+	virtual FArchive& operator<<(FName& N) override;
+
+private:
+	TArray<FName>& NameTable;
+	TMap<FName, int32> NameToIndex;
+};
+
+/**
+ * Packs and unpacks the actor bytes of a saved map
+ */
+struct FAuraSaveCodec
+{
+	// Actors written as tagged properties into the map's shared ActorBytes
+	static constexpr int32 CurrentSaveFormatVersion = 1;
+
+	static FName GetFormatName(ESaveCompression Compression);
+
+	/**
+	 * Serializes the SaveGame variables of Actors into RawBytes, in order, filling the matching SavedActors of SavedMap.
+	 * Values are copied on the game thread, then serialized in parallel and merged in actor order (Aura.Save.SerializeChunks).
+	 */
+	static void SerializeActors(TConstArrayView<AActor*> Actors, FSavedMap& SavedMap, TArray<uint8>& RawBytes);
+
+	/** Same output as SerializeActors, serializing the live actors one by one on the calling thread */
+	static void SerializeActorsSerial(TConstArrayView<AActor*> Actors, FSavedMap& SavedMap, TArray<uint8>& RawBytes);
+
+	/** Restores the SaveGame variables of Actor from the unpacked bytes of its map */
+	static bool DeserializeActor(AActor* Actor, const FSavedActor& SavedActor, const FSavedMap& SavedMap,
+	                             TConstArrayView<uint8> RawBytes);
+
+	/** Moves RawBytes into the map, compressed with FormatName when that makes them smaller */
+	static void PackActorBytes(FSavedMap& SavedMap, TArray<uint8>& RawBytes, FName FormatName);
+
+	/**
+	 * Returns the uncompressed actor bytes of the map. Raw bytes are viewed where they are stored in the map,
+	 * compressed ones are uncompressed into DecompressedBytes, which has to outlive OutRawBytes either way.
+	 */
+	static bool UnpackActorBytes(const FSavedMap& SavedMap, TArray<uint8>& DecompressedBytes,
+	                             TConstArrayView<uint8>& OutRawBytes);
+};
@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USaveGame;
+
+/**
+ * Reads and writes save slots so that a crash mid-write never loses the last good save.
+ * Slots are written to a temp slot first, the previous slot is kept as a backup,
+ * and a versioned header plus a CRC32 footer are verified on load.
+ */
+struct FAuraSaveGameStorage
+{
+	static bool SaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, int32 UserIndex);
+
+	/** Serializes the save game on the game thread and writes it on a background task. Writes land one at a time, in order */
+	static void AsyncSaveGameToSlot(USaveGame* SaveGameObject, const FString& SlotName, int32 UserIndex);
+
+	/** Blocks until every write started by AsyncSaveGameToSlot is on disk */
+	static void WaitForPendingWrites();
+
+	/** Loads the slot, falling back to its backup when the slot is missing or fails its checksum */
+	static USaveGame* LoadGameFromSlot(const FString& SlotName, int32 UserIndex);
+
+	static bool DoesSaveGameExist(const FString& SlotName, int32 UserIndex);
+
+	/** Deletes the slot along with its temp and backup copies */
+	static void DeleteGameInSlot(const FString& SlotName, int32 UserIndex);
+};
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraSpawnQueueSubsystem.generated.h"
+
+class AAuraEnemySpawnPoint;
+
+/**
+ * Spreads enemy waves over several frames.
+ * Each frame spawns at most MaxSpawnsPerFrame enemies and stops early once SpawnBudgetMs is used up,
+ * nearest spawn points first. Every wave logs its time to complete and its worst frame.
+ */
+UCLASS(Config=Game)
+class AURA_API UAuraSpawnQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Queues every spawn point of a wave, prioritized by distance to PriorityLocation */
+	void QueueWave(TConstArrayView<AAuraEnemySpawnPoint*> SpawnPoints, const FVector& PriorityLocation);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !PendingSpawns.IsEmpty(); }
+	virtual TStatId GetStatId() const override;
+
+private:
+	UPROPERTY(Config)
+	int32 MaxSpawnsPerFrame = 2;
+
+	/** At least one enemy is spawned per frame, even if it alone takes longer than this */
+	UPROPERTY(Config)
+	float SpawnBudgetMs = 2.f;
+
+	struct FPendingSpawn
+	{
+		TWeakObjectPtr<AAuraEnemySpawnPoint> SpawnPoint;
+		double DistanceSquared = 0.0;
+		int32 WaveId = 0;
+	};
+	/** Farthest first, so the next spawn is popped from the end */
+	TArray<FPendingSpawn> PendingSpawns;
+
+	struct FWave
+	{
+		double StartTime = 0.0;
+		int32 Num = 0;
+		int32 Remaining = 0;
+		double WorstFrameMs = 0.0;
+	};
+	TMap<int32, FWave> Waves;
+	int32 NextWaveId = 0;
+};
@@ -17,6 +17,14 @@ enum ESaveSlotStatus
 	Taken
 };
 
+UENUM(BlueprintType)
+enum class ESaveCompression : uint8
+{
+	None,
+	Zlib,
+	Oodle
+};
+
 USTRUCT()
 struct FSavedActor
 {
@@ -29,8 +37,20 @@ struct FSavedActor
 	FTransform Transform = FTransform();
 
 	// Serialized variables from the Actor - only those marked with SaveGame specifier
+	// Only used by saves written before the map name table was introduced
 	UPROPERTY()
 	TArray<uint8> Bytes;
+
+	// Location of this actor's serialized variables inside FSavedMap::ActorBytes
+	UPROPERTY()
+	int32 BytesOffset = 0;
+
+	UPROPERTY()
+	int32 BytesNum = 0;
+
+	// Maps the name indices written in this actor's bytes to FSavedMap::NameTable
+	UPROPERTY()
+	TArray<int32> NameIndices;
 };
 
 inline bool operator==(const FSavedActor& Left, const FSavedActor& Right)
@@ -48,6 +68,26 @@ struct FSavedMap
 
 	UPROPERTY()
 	TArray<FSavedActor> SavedActors;
+
+	// Every FName referenced by the saved actors, written once per map
+	UPROPERTY()
+	TArray<FName> NameTable;
+
+	// Serialized variables of all SavedActors, compressed with CompressionFormat
+	UPROPERTY()
+	TArray<uint8> ActorBytes;
+
+	// NAME_None when ActorBytes are stored raw
+	UPROPERTY()
+	FName CompressionFormat = NAME_None;
+
+	UPROPERTY()
+	int32 UncompressedSize = 0;
+
+	// 0 for saves that still store each actor's bytes inline in FSavedActor::Bytes,
+	// FAuraSaveCodec::CurrentSaveFormatVersion for the ones sharing ActorBytes
+	UPROPERTY()
+	int32 SaveFormatVersion = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -145,6 +185,9 @@ public:
 	TArray<FSavedMap> SavedMaps;
 
 	FSavedMap GetSavedMapWithMapName(const FString& InMapName);
+
+	/** Saved map with that name without copying its actor bytes, nullptr when the map was never saved */
+	const FSavedMap* FindSavedMap(const FString& InMapName) const;
 	
 	bool HasMap(const FString& InMapName);
 };
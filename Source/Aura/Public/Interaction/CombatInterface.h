@@ -18,6 +18,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDeathSignature, AActor*, DeadActo
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnDamageSignature, float /*DamageAmount*/);
 
+/** Which side a character fights on, fixed per character class so it can be compared without looking at actor tags */
+UENUM(BlueprintType)
+enum class EAuraTeam : uint8
+{
+	None,
+	Player,
+	Enemy
+};
+
 USTRUCT(BlueprintType)
 struct FTaggedMontage
 {
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "Components/ActorComponent.h"
+#include "Player/AuraSplinePathFollower.h"
+#include "AuraControllerCoreComponent.generated.h"
+
+class AMagicCircle;
+class UAuraAbilitySystemComponent;
+class UDamageTextComponent;
+class UNiagaraSystem;
+class USplineComponent;
+
+/** Player_Block_* tags of the controlled pawn, kept up to date from the ASC's tag events */
+enum class EAuraInputBlock : uint8
+{
+	None = 0,
+	InputPressed = 1 << 0,
+	InputHeld = 1 << 1,
+	InputReleased = 1 << 2,
+	CursorTrace = 1 << 3
+};
+ENUM_CLASS_FLAGS(EAuraInputBlock);
+
+/**
+ * Per-frame work shared by the player controllers: cursor trace and highlighting, click-to-move and auto-run,
+ * the magic circle and damage numbers. The owning controller keeps the Blueprint settings and hands them over in Setup.
+ */
+UCLASS()
+class AURA_API UAuraControllerCoreComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAuraControllerCoreComponent();
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	void Setup(USplineComponent* InSpline, UNiagaraSystem* InClickNiagaraSystem, float InAutoRunAcceptanceRadius,
+	           TSubclassOf<UDamageTextComponent> InDamageTextComponentClass, TSubclassOf<AMagicCircle> InMagicCircleClass);
+
+	/** Call before the controller processes input so the block tags are tracked before the first handler runs */
+	void PreProcessInput();
+	/** Cursor trace, auto-run and magic circle, after input has been processed */
+	void PlayerTick(float DeltaTime);
+
+	UAuraAbilitySystemComponent* GetASC();
+	bool IsBlocked(EAuraInputBlock Block) const { return EnumHasAnyFlags(BlockedInputs, Block); }
+
+	/** Stop auto-running and drop the path request in flight */
+	void StopAutoRun();
+	/** Move towards the cursor while the click is held */
+	void FollowCursor(float DeltaSeconds);
+	/** End of a click: a short press starts click-to-move, then the held time is reset */
+	void ReleaseFollowCursor();
+
+	void ShowDamageNumber(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit, bool bCriticalHit) const;
+	void ShowMagicCircle(UMaterialInterface* DecalMaterial);
+	void HideMagicCircle();
+
+	static void HighlightActor(AActor* InActor);
+	static void UnHighlightActor(AActor* InActor);
+
+	AActor* GetCurrentPointedActor() const { return CurrentPointedActor; }
+	/** Actor kept highlighted while the cursor moves elsewhere */
+	AActor* GetTargetActor() const { return TargetActor; }
+	void SetTargetActor(AActor* InTargetActor) { TargetActor = InTargetActor; }
+
+private:
+	/** Custom Ability System Component */
+	UPROPERTY()
+	TObjectPtr<UAuraAbilitySystemComponent> AuraAbilitySystemComponent;
+	/** Input gating is a bit test, the bits are flipped when a Player_Block_* tag is added or removed */
+	EAuraInputBlock BlockedInputs = EAuraInputBlock::None;
+	static TArray<TPair<FGameplayTag, EAuraInputBlock>, TFixedAllocator<4>> GetBlockTags();
+	void BindBlockTagEvents();
+	void BlockTagChanged(const FGameplayTag CallbackTag, int32 NewCount, EAuraInputBlock Block);
+
+	/** Do a line trace from the cursor location to the world */
+	void CursorTrace();
+	/** Resulting hit struct resulting of the CursorTrace() method */
+	FHitResult CursorHit;
+	/** What the last cursor trace depended on, a trace with the same inputs would hit the same thing */
+	struct FCursorTraceInputs
+	{
+		float MouseX = 0.f;
+		float MouseY = 0.f;
+		FVector ViewLocation = FVector::ZeroVector;
+		FRotator ViewRotation = FRotator::ZeroRotator;
+		float FOV = 0.f;
+		bool bMagicCircle = false;
+
+		bool operator==(const FCursorTraceInputs& Other) const
+		{
+			return MouseX == Other.MouseX && MouseY == Other.MouseY && ViewLocation == Other.ViewLocation &&
+				ViewRotation == Other.ViewRotation && FOV == Other.FOV && bMagicCircle == Other.bMagicCircle;
+		}
+	};
+	FCursorTraceInputs LastCursorTraceInputs;
+	/** World time of the last cursor trace */
+	double LastCursorTraceTime = -1.0;
+	/** Traces done since CursorTraceRateStartTime, published once per second as a stat */
+	int32 CursorTraceCount = 0;
+	double CursorTraceRateStartTime = 0.0;
+	void UpdateCursorTraceRate(double Now);
+	/** Actor under the cursor */
+	UPROPERTY()
+	TObjectPtr<AActor> CurrentPointedActor;
+	/** Actor under the cursor on the previous trace */
+	UPROPERTY()
+	TObjectPtr<AActor> PreviousPointedActor;
+	UPROPERTY()
+	TObjectPtr<AActor> TargetActor;
+
+	/** Determine if the player character is moving the a clicked point of getting close to a target */
+	bool bAutoRunning = false;
+	/** Current destination point where the character should move to */
+	UPROPERTY()
+	FVector CachedDestination = FVector::ZeroVector;
+	/** Time elapsed since the player held down the input */
+	float FollowTime = 0.f;
+	/** Minimum time the player must hold down the input to be considered a Held Input */
+	float ShortPressThreshold = 0.5f;
+	/** Minimum distance between the character and the spline point con consider the point reached */
+	float AutoRunAcceptanceRadius = 50.f;
+	/** Decal to spawn when click on a navigable point */
+	UPROPERTY()
+	TObjectPtr<UNiagaraSystem> ClickNiagaraSystem;
+	/** NavigationMesh Points Collection, owned by the controller */
+	UPROPERTY()
+	TObjectPtr<USplineComponent> Spline;
+	/** Move the character to each Spline collection point */
+	void AutoRun();
+	/** Tracks how far along the Spline the character is */
+	FAuraSplinePathFollower PathFollower;
+	/** Id of the async path query of the last click, INVALID_NAVQUERYID when none is in flight */
+	uint32 PathQueryID = INVALID_NAVQUERYID;
+	/** Request a path to CachedDestination, moving straight towards it until the path arrives */
+	void RequestPathToCachedDestination(const APawn* ControlledPawn);
+	void AbortPathRequest();
+	void OnPathFound(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr NavPath);
+
+	/** WidgetComponent class of the damage of effects IU view */
+	UPROPERTY()
+	TSubclassOf<UDamageTextComponent> DamageTextComponentClass;
+
+	/** Magic Circle Class */
+	UPROPERTY()
+	TSubclassOf<AMagicCircle> MagicCircleClass;
+	/** Magic Circle Instance */
+	UPROPERTY()
+	TObjectPtr<AMagicCircle> MagicCircle;
+	void UpdateMagicCircleLocation() const;
+};
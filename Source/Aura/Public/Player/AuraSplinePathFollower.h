@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+
+/**
+ * Follows a click-to-move spline without searching the whole spline every tick.
+ * The follower remembers the segment it is on and only ever moves forward,
+ * so each update evaluates a single segment no matter how long the path is.
+ */
+struct FAuraSplinePathFollower
+{
+	/** Start again from the first spline point, call whenever the spline points change */
+	void Reset();
+
+	/**
+	 * Advance along the spline from the pawn location and get the direction to move in.
+	 * Returns false once the point reached on the spline is within AcceptanceRadius of its last point.
+	 */
+	bool Update(const USplineComponent* Spline, const FVector& Location, float AcceptanceRadius, FVector& OutDirection);
+
+	float GetInputKey() const { return SegmentIndex + SegmentAlpha; }
+
+private:
+	int32 SegmentIndex = 0;
+	float SegmentAlpha = 0.f;
+};
@@ -11,10 +11,10 @@
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerTargetChanged, AActor* /*TargetActor*/)
 
 class AMagicCircle;
+class UAuraControllerCoreComponent;
 class UDamageTextComponent;
 class USplineComponent;
 class UNiagaraSystem;
-class UAuraAbilitySystemComponent;
 struct FGameplayTag;
 struct FInputActionValue;
 class UInputAction;
@@ -102,53 +102,26 @@ private:
 	void AbilityInputTagReleased(FGameplayTag InputTag);
 	void AbilityInputTagHeld(FGameplayTag InputTag);
 
-	/** Custom Ability System Component */
-	UPROPERTY()
-	TObjectPtr<UAuraAbilitySystemComponent> EtherniaAbilitySystemComponent;
-	/** Get the Ability System Component */
-	UAuraAbilitySystemComponent* GetASC();
-
-	/** Current player's target */
-	TObjectPtr<AActor> TargetActor;
-	/** Current player's target */
-	TObjectPtr<AActor> CurrentPointedActor;
-	/** Previous player's target */
-	TObjectPtr<AActor> PreviousPointedActor;
+	/** Cursor trace, click-to-move, magic circle and damage numbers */
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<UAuraControllerCoreComponent> ControllerCore;
+
 	/** status of the player target */
 	ETargetingStatus TargetingStatus = ETargetingStatus::NotTargeting;
 
 	UFUNCTION()
 	void TargetActorDied(AActor* DeadActor);
 
-	/** Determine if the player character is moving the a clicked point of getting close to a target */
-	bool bAutoRunning = false;
-	/** Current destination point where the character should move to */
-	FVector CachedDestination = FVector::ZeroVector;
-	/** Time elapsed since the player held down the input */
-	float InputElapsedTimeHeld = 0.f;
-	/** Minimum time the player must hold down the input to be considered a Held Input */
-	float ShortPressThreshold = 0.5f;
 	/** Decal to spawn when click on a navigable point */
 	UPROPERTY(EditDefaultsOnly)
 	TObjectPtr<UNiagaraSystem> ClickDecal;
 	/** NavigationMesh Points Collection */
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USplineComponent> Spline;
-	/** Move the character to each Spline collection point */
-	void AutoRun();
 	/** Minimum distance between the character and the spline point con consider the point reached */
 	UPROPERTY(EditDefaultsOnly)
 	float AutoRunAcceptanceRadius = 50.f;
 
-	/** Do a line trace from the cursor location to the world */
-	void CursorTrace();
-	/** Resulting hit struct resulting of the  CursorHit() method */
-	FHitResult CursorHit;
-	/** Highlight a desire actor */
-	static void HighlightActor(AActor* InActor);
-	/** UnHighlight a desire actor */
-	static void UnHighlightActor(AActor* InActor);
-
 	/** WidgetComponent class of the damage of effects IU view */
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UDamageTextComponent> DamageTextComponentClass;
@@ -156,14 +129,9 @@ private:
 	/** Magic Circle Class */
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<AMagicCircle> MagicCircleClass;
-	/** Magic Circle Instance */
-	UPROPERTY()
-	TObjectPtr<AMagicCircle> MagicCircle;
-	/** Magic Circle Instance */
-	void UpdateMagicCircleLocation() const;
 
 	bool bTargeting = false;
 
 public:
-	FORCEINLINE AActor* GetTargetActor() const { return TargetActor; };
+	AActor* GetTargetActor() const;
 };